@@ -0,0 +1,60 @@
+// Throughput of the batch API against the single-item send/receive path
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../include/channel.hpp"
+
+using namespace std;
+
+constexpr size_t total_items = 2000000;
+constexpr size_t capacity = 1024;
+
+// One producer and one consumer moving total_items through a buffered channel
+double run_single() {
+    Channel<int> ch(capacity);
+    auto start = chrono::steady_clock::now();
+
+    thread producer([&]() {
+        for (size_t i = 0; i < total_items; ++i) ch.send(static_cast<int>(i));
+        ch.close();
+    });
+    size_t received = 0;
+    while (ch.receive()) ++received;
+    producer.join();
+
+    return received / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Same traffic, but both sides move `batch` items per call
+double run_batch(size_t batch) {
+    Channel<int> ch(capacity);
+    auto start = chrono::steady_clock::now();
+
+    thread producer([&]() {
+        vector<int> chunk(batch);
+        for (size_t i = 0; i < total_items; i += batch) {
+            size_t n = min(batch, total_items - i);
+            for (size_t j = 0; j < n; ++j) chunk[j] = static_cast<int>(i + j);
+            ch.send_n(chunk.begin(), n);
+        }
+        ch.close();
+    });
+    vector<int> out(batch);
+    size_t received = 0;
+    while (size_t n = ch.receive_batch(out.begin(), batch)) received += n;
+    producer.join();
+
+    return received / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    printf("%-12s %14s\n", "mode", "msgs/sec");
+    printf("%-12s %14.0f\n", "single", run_single());
+    for (size_t batch : {8, 64, 256}) {
+        printf("batch-%-6zu %14.0f\n", batch, run_batch(batch));
+    }
+    return 0;
+}
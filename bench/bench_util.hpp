@@ -0,0 +1,127 @@
+#pragma once
+
+// Shared helpers for the benchmark binaries: timing, latency percentiles and CSV/JSON output
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bench {
+
+// Pins the calling thread to `core` (modulo the core count) so two-thread scenarios do not migrate;
+// a no-op off Linux
+inline void pin_to_core(unsigned core) {
+#ifdef __linux__
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+// Monotonic timestamp in nanoseconds, comparable across threads
+inline std::int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// One measured scenario
+struct Result {
+    std::string name;
+    std::size_t ops = 0;
+    double seconds = 0;
+    std::vector<std::int64_t> latencies_ns;  // Optional per-operation samples
+};
+
+// Nearest-rank percentile over sorted samples, 0 when there are none
+inline std::int64_t percentile(const std::vector<std::int64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    auto rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+// Collects results and prints them in a machine-readable format
+class Reporter {
+   public:
+    enum class Format { CSV,
+                        JSON };
+
+    // Parses --format=csv|json and --filter=<substring>
+    Reporter(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            if (std::strcmp(argv[i], "--format=json") == 0) {
+                format_ = Format::JSON;
+            } else if (std::strcmp(argv[i], "--format=csv") == 0) {
+                format_ = Format::CSV;
+            } else if (std::strncmp(argv[i], "--filter=", 9) == 0) {
+                filter_ = argv[i] + 9;
+            }
+        }
+    }
+
+    // Whether a scenario with this name should run
+    bool enabled(const std::string& name) const {
+        return filter_.empty() || name.find(filter_) != std::string::npos;
+    }
+
+    // Prints one result immediately so long runs show progress
+    void report(Result result) {
+        std::sort(result.latencies_ns.begin(), result.latencies_ns.end());
+        double ops_per_sec = result.seconds > 0 ? static_cast<double>(result.ops) / result.seconds : 0;
+        auto p50 = percentile(result.latencies_ns, 0.50);
+        auto p99 = percentile(result.latencies_ns, 0.99);
+        auto p999 = percentile(result.latencies_ns, 0.999);
+
+        if (format_ == Format::CSV) {
+            if (count_ == 0) std::printf("name,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns\n");
+            std::printf("%s,%zu,%.6f,%.0f,%lld,%lld,%lld\n", result.name.c_str(), result.ops, result.seconds,
+                        ops_per_sec, static_cast<long long>(p50), static_cast<long long>(p99),
+                        static_cast<long long>(p999));
+        } else {
+            std::printf("%s{\"name\":\"%s\",\"ops\":%zu,\"seconds\":%.6f,\"ops_per_sec\":%.0f,"
+                        "\"p50_ns\":%lld,\"p99_ns\":%lld,\"p999_ns\":%lld}",
+                        count_ == 0 ? "[\n  " : ",\n  ", result.name.c_str(), result.ops, result.seconds,
+                        ops_per_sec, static_cast<long long>(p50), static_cast<long long>(p99),
+                        static_cast<long long>(p999));
+        }
+        std::fflush(stdout);
+        count_++;
+    }
+
+    ~Reporter() {
+        if (format_ == Format::JSON) std::printf(count_ == 0 ? "[]\n" : "\n]\n");
+    }
+
+   private:
+    Format format_ = Format::CSV;
+    std::string filter_;
+    std::size_t count_ = 0;
+};
+
+// Runs `body` and fills in the elapsed time
+template <typename F>
+Result measure(const std::string& name, std::size_t ops, F&& body) {
+    Result result;
+    result.name = name;
+    result.ops = ops;
+    auto start = std::chrono::steady_clock::now();
+    body(result);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+}  // namespace bench
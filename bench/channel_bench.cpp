@@ -0,0 +1,448 @@
+// Throughput and latency benchmarks for Channel, SpscChannel and Select
+//
+// Usage: build/channel_bench [--format=csv|json] [--filter=<substring>]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/broadcast_channel.hpp"
+#include "../include/channel.hpp"
+#include "../include/select.hpp"
+#include "../include/sharded_channel.hpp"
+#include "../include/spsc_channel.hpp"
+#include "bench_util.hpp"
+
+using namespace std;
+using bench::now_ns;
+using bench::Result;
+
+using Stamp = int64_t;  // Every message carries its send time so receivers can record latency
+
+// Unbuffered round trips between two threads; latency is one full round trip
+Result unbuffered_ping_pong(size_t rounds) {
+    return bench::measure("unbuffered_ping_pong", rounds, [&](Result& r) {
+        Channel<Stamp> ping, pong;
+        thread echo([&]() {
+            while (auto v = ping.receive()) pong.send(*v);
+        });
+
+        r.latencies_ns.reserve(rounds);
+        for (size_t i = 0; i < rounds; ++i) {
+            Stamp start = now_ns();
+            ping.send(start);
+            pong.receive();
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+        ping.close();
+        echo.join();
+    });
+}
+
+// Round trips on a pair of channels using the given wait strategy; spin counters go to stderr
+Result strategy_ping_pong(const string& name, size_t capacity, WaitStrategy strategy, size_t rounds) {
+    return bench::measure(name, rounds, [&](Result& r) {
+        Channel<Stamp> ping(capacity, strategy), pong(capacity, strategy);
+        thread echo([&]() {
+            while (auto v = ping.receive()) pong.send(*v);
+        });
+
+        r.latencies_ns.reserve(rounds);
+        for (size_t i = 0; i < rounds; ++i) {
+            Stamp start = now_ns();
+            ping.send(start);
+            pong.receive();
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+        ping.close();
+        echo.join();
+
+        WaitStats a = ping.wait_stats(), b = pong.wait_stats();
+        fprintf(stderr, "%s: spin_successes=%llu spin_failures=%llu\n", name.c_str(),
+                static_cast<unsigned long long>(a.spin_successes + b.spin_successes),
+                static_cast<unsigned long long>(a.spin_failures + b.spin_failures));
+    });
+}
+
+// `producers` senders and `consumers` receivers sharing one channel of the given capacity
+// (a size, or ResizableCapacity)
+template <typename Capacity>
+Result fan(const string& name, Capacity capacity, int producers, int consumers, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        vector<vector<int64_t>> latencies(consumers);
+
+        vector<thread> receivers;
+        for (int c = 0; c < consumers; ++c) {
+            receivers.emplace_back([&, c]() {
+                latencies[c].reserve(total / consumers + 1);
+                while (auto v = ch.receive()) latencies[c].push_back(now_ns() - *v);
+            });
+        }
+
+        vector<thread> senders;
+        for (int p = 0; p < producers; ++p) {
+            size_t share = total / producers + (static_cast<size_t>(p) < total % producers ? 1 : 0);
+            senders.emplace_back([&ch, share]() {
+                for (size_t i = 0; i < share; ++i) ch.send(now_ns());
+            });
+        }
+
+        for (auto& t : senders) t.join();
+        ch.close();
+        for (auto& t : receivers) t.join();
+        for (auto& l : latencies) r.latencies_ns.insert(r.latencies_ns.end(), l.begin(), l.end());
+    });
+}
+
+// fan() over a ShardedChannel with one shard per producer, each holding an equal part of `capacity`
+Result sharded_fan(const string& name, size_t capacity, int producers, int consumers, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        ShardedChannel<Stamp> ch(capacity / producers, producers);
+        vector<vector<int64_t>> latencies(consumers);
+
+        vector<thread> receivers;
+        for (int c = 0; c < consumers; ++c) {
+            receivers.emplace_back([&, c]() {
+                latencies[c].reserve(total / consumers + 1);
+                while (auto v = ch.receive()) latencies[c].push_back(now_ns() - *v);
+            });
+        }
+
+        vector<thread> senders;
+        for (int p = 0; p < producers; ++p) {
+            size_t share = total / producers + (static_cast<size_t>(p) < total % producers ? 1 : 0);
+            senders.emplace_back([&ch, share]() {
+                for (size_t i = 0; i < share; ++i) ch.send(now_ns());
+            });
+        }
+
+        for (auto& t : senders) t.join();
+        ch.close();
+        for (auto& t : receivers) t.join();
+        for (auto& l : latencies) r.latencies_ns.insert(r.latencies_ns.end(), l.begin(), l.end());
+    });
+}
+
+// One sender and one receiver pinned to different cores, over an SpscChannel or a buffered Channel
+// of the same capacity; compare spsc_pinned_cap<n> with channel_pinned_cap<n>
+template <typename Chan>
+Result pinned_pair(const string& name, size_t capacity, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        Chan ch(capacity);
+        thread sender([&]() {
+            bench::pin_to_core(0);
+            for (size_t i = 0; i < total; ++i) ch.send(now_ns());
+            ch.close();
+        });
+
+        bench::pin_to_core(1);
+        r.latencies_ns.reserve(total);
+        while (auto v = ch.receive()) r.latencies_ns.push_back(now_ns() - *v);
+        sender.join();
+    });
+}
+
+// `pairs` independent capacity-64 channels side by side in one vector, each with its own sender and receiver.
+// Nothing is shared between pairs, so throughput should scale with cores; any shortfall is false
+// sharing between neighbouring channels or between the two sides of one channel. Run under
+// `perf stat -e cache-misses` (or perf c2c) to see the coherence traffic.
+struct Lane : Channel<Stamp> {
+    Lane() : Channel<Stamp>(64) {}  // Channels cannot be moved, so a vector can only default-construct them
+};
+
+Result independent_pairs(size_t pairs, size_t per_pair) {
+    return bench::measure("independent_pairs_" + to_string(pairs), pairs * per_pair, [&](Result& r) {
+        vector<Lane> chans(pairs);
+        vector<vector<int64_t>> latencies(pairs);
+
+        vector<thread> threads;
+        for (size_t p = 0; p < pairs; ++p) {
+            threads.emplace_back([&, p]() {
+                latencies[p].reserve(per_pair);
+                while (auto v = chans[p].receive()) latencies[p].push_back(now_ns() - *v);
+            });
+            threads.emplace_back([&, p]() {
+                for (size_t i = 0; i < per_pair; ++i) chans[p].send(now_ns());
+                chans[p].close();
+            });
+        }
+
+        for (auto& t : threads) t.join();
+        for (auto& l : latencies) r.latencies_ns.insert(r.latencies_ns.end(), l.begin(), l.end());
+    });
+}
+
+// A producer feeding a consumer that pauses every 64 items; latency is the time spent inside send(), so
+// Block shows the stalls the lossy overflow policies avoid
+Result slow_consumer(const string& name, size_t capacity, OverflowPolicy overflow, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        Channel<Stamp> ch(capacity, overflow);
+        thread consumer([&]() {
+            for (size_t n = 1; ch.receive(); ++n) {
+                if (n % 64 == 0) this_thread::sleep_for(chrono::microseconds(50));
+            }
+        });
+
+        r.latencies_ns.reserve(total);
+        for (size_t i = 0; i < total; ++i) {
+            Stamp start = now_ns();
+            ch.send(start);
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+        ch.close();
+        consumer.join();
+    });
+}
+
+// One sender fanned out to `subscribers` receivers through a relay thread that re-sends each item on a
+// channel per receiver; the baseline for broadcast_1_to_<n>. Counts every delivery as one op
+Result relay_fan_out(size_t subscribers, size_t total) {
+    return bench::measure("relay_1_to_" + to_string(subscribers), total * subscribers, [&](Result& r) {
+        Channel<Stamp> source(1024);
+        vector<unique_ptr<Channel<Stamp>>> outs;
+        for (size_t i = 0; i < subscribers; ++i) outs.push_back(make_unique<Channel<Stamp>>(1024));
+        vector<vector<int64_t>> latencies(subscribers);
+
+        vector<thread> threads;
+        for (size_t s = 0; s < subscribers; ++s) {
+            threads.emplace_back([&, s]() {
+                latencies[s].reserve(total);
+                while (auto v = outs[s]->receive()) latencies[s].push_back(now_ns() - *v);
+            });
+        }
+        threads.emplace_back([&]() {
+            while (auto v = source.receive()) {
+                for (auto& out : outs) out->send(*v);
+            }
+            for (auto& out : outs) out->close();
+        });
+
+        for (size_t i = 0; i < total; ++i) source.send(now_ns());
+        source.close();
+        for (auto& t : threads) t.join();
+        for (auto& l : latencies) r.latencies_ns.insert(r.latencies_ns.end(), l.begin(), l.end());
+    });
+}
+
+// The same fan-out through one BroadcastChannel: each item is written once and read by every subscriber
+Result broadcast_fan_out(size_t subscribers, size_t total) {
+    return bench::measure("broadcast_1_to_" + to_string(subscribers), total * subscribers, [&](Result& r) {
+        BroadcastChannel<Stamp> ch(1024);
+        vector<BroadcastChannel<Stamp>::Subscriber> subs;
+        for (size_t i = 0; i < subscribers; ++i) subs.push_back(ch.subscribe());
+        vector<vector<int64_t>> latencies(subscribers);
+
+        vector<thread> threads;
+        for (size_t s = 0; s < subscribers; ++s) {
+            threads.emplace_back([&, s]() {
+                latencies[s].reserve(total);
+                while (auto v = subs[s].receive()) latencies[s].push_back(now_ns() - *v);
+            });
+        }
+
+        for (size_t i = 0; i < total; ++i) ch.send(now_ns());
+        ch.close();
+        for (auto& t : threads) t.join();
+        for (auto& l : latencies) r.latencies_ns.insert(r.latencies_ns.end(), l.begin(), l.end());
+    });
+}
+
+// One sender, one receiver using receive_for; compare with buffered_cap<capacity> to see what the timeout costs
+Result timed_receive(size_t capacity, size_t total) {
+    return bench::measure("timed_receive_cap" + to_string(capacity), total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        thread sender([&]() {
+            for (size_t i = 0; i < total; ++i) ch.send(now_ns());
+            ch.close();
+        });
+
+        r.latencies_ns.reserve(total);
+        while (auto v = ch.receive_for(chrono::seconds(1))) r.latencies_ns.push_back(now_ns() - *v);
+        sender.join();
+    });
+}
+
+// One sender, one receiver draining with a range-for; compare with buffered_cap<capacity>
+Result range_receive(size_t capacity, size_t total) {
+    return bench::measure("range_for_cap" + to_string(capacity), total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        thread sender([&]() {
+            for (size_t i = 0; i < total; ++i) ch.send(now_ns());
+            ch.close();
+        });
+
+        r.latencies_ns.reserve(total);
+        for (Stamp v : ch) r.latencies_ns.push_back(now_ns() - v);
+        sender.join();
+    });
+}
+
+// Both sides poll with try_send/try_receive and yield on failure
+Result try_spin(size_t capacity, size_t total) {
+    return bench::measure("try_spin_cap" + to_string(capacity), total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        thread sender([&]() {
+            for (size_t i = 0; i < total; ++i) {
+                while (!ch.try_send(now_ns())) this_thread::yield();
+            }
+        });
+
+        r.latencies_ns.reserve(total);
+        for (size_t received = 0; received < total;) {
+            if (auto v = ch.try_receive()) {
+                r.latencies_ns.push_back(now_ns() - *v);
+                received++;
+            } else {
+                this_thread::yield();
+            }
+        }
+        sender.join();
+    });
+}
+
+// async_receive paired with async_send on an unbuffered channel; latency is until both futures resolve
+Result async_pairs(size_t pairs) {
+    return bench::measure("async_send_receive", pairs, [&](Result& r) {
+        Channel<Stamp> ch;
+        r.latencies_ns.reserve(pairs);
+        for (size_t i = 0; i < pairs; ++i) {
+            Stamp start = now_ns();
+            auto recv = ch.async_receive();
+            auto sent = ch.async_send(start);
+            sent.get();
+            recv.get();
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+    });
+}
+
+// One sender spreading messages over `width` channels, one receiver looping on Select::run_blocking
+Result select_blocking(size_t width, size_t total) {
+    return bench::measure("select_run_blocking_" + to_string(width), total, [&](Result& r) {
+        vector<unique_ptr<Channel<Stamp>>> chans;
+        for (size_t i = 0; i < width; ++i) chans.push_back(make_unique<Channel<Stamp>>(64));
+
+        Select<Stamp> sel;
+        for (auto& ch : chans) sel.receive(*ch);
+
+        thread sender([&]() {
+            for (size_t i = 0; i < total; ++i) chans[i % width]->send(now_ns());
+        });
+
+        r.latencies_ns.reserve(total);
+        for (size_t received = 0; received < total;) {
+            if (!sel.run_blocking(chrono::milliseconds(100))) continue;
+            if (auto v = sel.take_received_value()) {
+                r.latencies_ns.push_back(now_ns() - *v);
+                received++;
+            }
+        }
+        sender.join();
+    });
+}
+
+// Non-blocking Select::run() over `width` always-ready channels; measures the cost of choosing a case
+Result select_run(SelectPolicy policy, const string& name, size_t width, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        vector<unique_ptr<Channel<Stamp>>> chans;
+        for (size_t i = 0; i < width; ++i) chans.push_back(make_unique<Channel<Stamp>>(1));
+
+        Select<Stamp> sel(policy);
+        for (auto& ch : chans) sel.receive(*ch);
+
+        r.latencies_ns.reserve(total);
+        for (size_t i = 0; i < total; ++i) {
+            for (auto& ch : chans) ch->try_send(0);  // Refill the one drained last round
+            Stamp start = now_ns();
+            sel.run();
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Reporter reporter(argc, argv);
+    auto run = [&](const string& name, auto&& scenario) {
+        if (reporter.enabled(name)) reporter.report(scenario());
+    };
+
+    run("unbuffered_ping_pong", [] { return unbuffered_ping_pong(20000); });
+
+    for (auto [strategy, label] : {pair{WaitStrategy::block(), "block"}, pair{WaitStrategy::spin_then_park(), "spin_then_park"},
+                                   pair{WaitStrategy::busy_spin(), "busy_spin"}}) {
+        for (size_t cap : {0, 1}) {
+            string name = "ping_pong_cap" + to_string(cap) + "_" + label;
+            run(name, [&] { return strategy_ping_pong(name, cap, strategy, 20000); });
+        }
+    }
+
+    for (size_t cap : {1, 64, 4096}) {
+        string name = "buffered_cap" + to_string(cap);
+        run(name, [&] { return fan(name, cap, 1, 1, 200000); });
+    }
+
+    // Pinned 1P/1C: the SPSC ring against the MPMC ring it replaces
+    for (size_t cap : {64, 4096}) {
+        string spsc = "spsc_pinned_cap" + to_string(cap), chan = "channel_pinned_cap" + to_string(cap);
+        run(spsc, [&] { return pinned_pair<SpscChannel<Stamp>>(spsc, cap, 2000000); });
+        run(chan, [&] { return pinned_pair<Channel<Stamp>>(chan, cap, 2000000); });
+    }
+
+    for (size_t cap : {64, 4096}) {
+        run("range_for_cap" + to_string(cap), [&] { return range_receive(cap, 200000); });
+    }
+
+    for (size_t cap : {1, 64}) {
+        run("timed_receive_cap" + to_string(cap), [&] { return timed_receive(cap, 200000); });
+    }
+
+    for (size_t pairs : {1, 2, 4, 8}) {
+        run("independent_pairs_" + to_string(pairs), [&] { return independent_pairs(pairs, 200000); });
+    }
+
+    run("fan_1_to_4", [] { return fan("fan_1_to_4", 1024, 1, 4, 200000); });
+    run("fan_4_to_1", [] { return fan("fan_4_to_1", 1024, 4, 1, 200000); });
+    run("fan_4_to_4", [] { return fan("fan_4_to_4", 1024, 4, 4, 200000); });
+    run("sharded_fan_4_to_4", [] { return sharded_fan("sharded_fan_4_to_4", 1024, 4, 4, 200000); });
+
+    run("unbounded_1_to_1", [] { return fan("unbounded_1_to_1", Channel<Stamp>::unbounded, 1, 1, 200000); });
+    run("unbounded_fan_4_to_1", [] { return fan("unbounded_fan_4_to_1", Channel<Stamp>::unbounded, 4, 1, 200000); });
+
+    // Resizable channels admit sends through a shared counter; compare with buffered_cap64 and fan_4_to_4
+    run("resizable_cap64", [] { return fan("resizable_cap64", ResizableCapacity{64}, 1, 1, 200000); });
+    run("resizable_fan_4_to_4", [] { return fan("resizable_fan_4_to_4", ResizableCapacity{1024}, 4, 4, 200000); });
+
+    // Producer-side send latency against a slow consumer, per overflow policy
+    for (auto [overflow, label] : {pair{OverflowPolicy::Block, "block"}, pair{OverflowPolicy::DropNewest, "drop_newest"},
+                                   pair{OverflowPolicy::DropOldest, "drop_oldest"}}) {
+        string name = string("slow_consumer_cap64_") + label;
+        run(name, [&] { return slow_consumer(name, 64, overflow, 100000); });
+    }
+    run("slow_consumer_keep_latest", [] { return slow_consumer("slow_consumer_keep_latest", 1, OverflowPolicy::KeepLatest, 100000); });
+
+    // Fan-out to 4 subscribers: relay thread and per-subscriber channels against one broadcast ring
+    run("relay_1_to_4", [] { return relay_fan_out(4, 100000); });
+    run("broadcast_1_to_4", [] { return broadcast_fan_out(4, 100000); });
+
+    run("try_spin_cap64", [] { return try_spin(64, 200000); });
+
+    run("async_send_receive", [] { return async_pairs(2000); });
+
+    for (size_t width : {2, 8, 64}) {
+        run("select_run_blocking_" + to_string(width), [&] { return select_blocking(width, 5000); });
+    }
+
+    for (auto [policy, label] : {pair{SelectPolicy::Random, "random"}, pair{SelectPolicy::Priority, "priority"},
+                                 pair{SelectPolicy::RoundRobin, "round_robin"}}) {
+        string name = string("select_run_") + label + "_8";
+        run(name, [&] { return select_run(policy, name, 8, 200000); });
+    }
+
+    return 0;
+}
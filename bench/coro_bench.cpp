@@ -0,0 +1,122 @@
+// Coroutine handoff on one CoroScheduler compared with the same handoff between two threads
+//
+// Usage: build/coro_bench [--format=csv|json] [--filter=<substring>]
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "../include/channel.hpp"
+#include "bench_util.hpp"
+
+using namespace std;
+using bench::now_ns;
+using bench::Result;
+
+using Stamp = int64_t;
+
+#if CHANNEL_HAS_COROUTINES
+
+Task<void> coro_echo(Channel<Stamp>& ping, Channel<Stamp>& pong) {
+    while (auto v = co_await ping.receive_awaitable()) co_await pong.async_send_awaitable(*v);
+}
+
+Task<void> coro_driver(Channel<Stamp>& ping, Channel<Stamp>& pong, size_t rounds, Result& r) {
+    for (size_t i = 0; i < rounds; ++i) {
+        Stamp start = now_ns();
+        co_await ping.async_send_awaitable(start);
+        co_await pong.receive_awaitable();
+        r.latencies_ns.push_back(now_ns() - start);
+    }
+    ping.close();
+}
+
+// Round trips between two coroutines on the same scheduler thread
+Result coro_ping_pong(const string& name, size_t capacity, size_t rounds) {
+    return bench::measure(name, rounds, [&](Result& r) {
+        Channel<Stamp> ping(capacity), pong(capacity);
+        r.latencies_ns.reserve(rounds);
+
+        CoroScheduler scheduler;
+        scheduler.spawn(coro_echo(ping, pong));
+        scheduler.spawn(coro_driver(ping, pong, rounds, r));
+        scheduler.run();
+    });
+}
+
+Task<void> coro_sink(Channel<Stamp>& ch, Result& r) {
+    while (auto v = co_await ch.receive_awaitable()) r.latencies_ns.push_back(now_ns() - *v);
+}
+
+Task<void> coro_source(Channel<Stamp>& ch, size_t total) {
+    for (size_t i = 0; i < total; ++i) co_await ch.async_send_awaitable(now_ns());
+    ch.close();
+}
+
+// One-way stream between two coroutines on the same scheduler thread
+Result coro_stream(const string& name, size_t capacity, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        r.latencies_ns.reserve(total);
+
+        CoroScheduler scheduler;
+        scheduler.spawn(coro_sink(ch, r));
+        scheduler.spawn(coro_source(ch, total));
+        scheduler.run();
+    });
+}
+
+#endif  // CHANNEL_HAS_COROUTINES
+
+// The same round trips with one blocking thread per side
+Result thread_ping_pong(const string& name, size_t capacity, size_t rounds) {
+    return bench::measure(name, rounds, [&](Result& r) {
+        Channel<Stamp> ping(capacity), pong(capacity);
+        thread echo([&]() {
+            while (auto v = ping.receive()) pong.send(*v);
+        });
+
+        r.latencies_ns.reserve(rounds);
+        for (size_t i = 0; i < rounds; ++i) {
+            Stamp start = now_ns();
+            ping.send(start);
+            pong.receive();
+            r.latencies_ns.push_back(now_ns() - start);
+        }
+        ping.close();
+        echo.join();
+    });
+}
+
+// The same one-way stream with one blocking thread per side
+Result thread_stream(const string& name, size_t capacity, size_t total) {
+    return bench::measure(name, total, [&](Result& r) {
+        Channel<Stamp> ch(capacity);
+        thread source([&]() {
+            for (size_t i = 0; i < total; ++i) ch.send(now_ns());
+            ch.close();
+        });
+
+        r.latencies_ns.reserve(total);
+        while (auto v = ch.receive()) r.latencies_ns.push_back(now_ns() - *v);
+        source.join();
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Reporter reporter(argc, argv);
+    auto run = [&](const string& name, auto&& scenario) {
+        if (reporter.enabled(name)) reporter.report(scenario());
+    };
+
+    run("thread_ping_pong_unbuffered", [] { return thread_ping_pong("thread_ping_pong_unbuffered", 0, 20000); });
+    run("thread_stream_cap64", [] { return thread_stream("thread_stream_cap64", 64, 200000); });
+
+#if CHANNEL_HAS_COROUTINES
+    run("coro_ping_pong_unbuffered", [] { return coro_ping_pong("coro_ping_pong_unbuffered", 0, 200000); });
+    run("coro_stream_unbuffered", [] { return coro_stream("coro_stream_unbuffered", 0, 200000); });
+    run("coro_stream_cap64", [] { return coro_stream("coro_stream_cap64", 64, 200000); });
+#endif
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Pipelines built with the combinators against the same stages hand-wired with a thread and a channel each
+//
+// Usage: build/pipeline_bench [--format=csv|json] [--filter=<substring>]
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/pipeline.hpp"
+#include "bench_util.hpp"
+
+using namespace std;
+using bench::now_ns;
+using bench::Result;
+
+using Stamp = int64_t;
+
+// Every message carries its send time so the sink can record end-to-end latency
+struct Msg {
+    Stamp sent;
+    int64_t value;
+};
+
+constexpr size_t capacity = 1024;
+
+Msg scale(Msg m) { return {m.sent, m.value * 3 + 1}; }
+bool keep(const Msg& m) { return m.value % 4 != 0; }
+Msg offset(Msg m) { return {m.sent, m.value - 7}; }
+
+// A stage with some real work in it, so parallel workers have something to split
+Msg crunch(Msg m) {
+    int64_t x = m.value;
+    for (int i = 0; i < 200; ++i) x = x * 6364136223846793005LL + 1442695040888963407LL;
+    return {m.sent, x};
+}
+
+// Sends `total` stamped messages and closes the source; the sink is drained on the calling thread
+template <typename Wire>
+Result run_pipeline(const string& name, size_t total, Wire wire) {
+    return bench::measure(name, total, [&](Result& r) {
+        Channel<Msg> source(capacity), sink(capacity);
+        auto stop = wire(source, sink);
+
+        thread producer([&]() {
+            for (size_t i = 0; i < total; ++i) source.send(Msg{now_ns(), static_cast<int64_t>(i)});
+            source.close();
+        });
+
+        r.latencies_ns.reserve(total);
+        for (const Msg& m : sink) r.latencies_ns.push_back(now_ns() - m.sent);
+        producer.join();
+        stop();
+    });
+}
+
+// map -> filter -> map with one thread per stage and a channel between each pair of stages
+auto hand_wired_three_stages(Channel<Msg>& source, Channel<Msg>& sink) {
+    auto a = make_shared<Channel<Msg>>(capacity), b = make_shared<Channel<Msg>>(capacity);
+    auto threads = make_shared<vector<thread>>();
+    threads->emplace_back([&source, a]() {
+        while (auto m = source.receive()) a->send(scale(*m));
+        a->close();
+    });
+    threads->emplace_back([a, b]() {
+        while (auto m = a->receive()) {
+            if (keep(*m)) b->send(*m);
+        }
+        b->close();
+    });
+    threads->emplace_back([b, &sink]() {
+        while (auto m = b->receive()) sink.send(offset(*m));
+        sink.close();
+    });
+    return [threads]() {
+        for (auto& t : *threads) t.join();
+    };
+}
+
+// The same stages through the combinators: fused onto a single worker
+auto fused_three_stages(Channel<Msg>& source, Channel<Msg>& sink) {
+    auto run = make_shared<PipelineRun>(Pipeline<Msg>::from(source).map(scale).filter(keep).map(offset).to(sink));
+    return [run]() { run->join(); };
+}
+
+// `workers` threads running crunch() off one source into one sink
+auto hand_wired_parallel(size_t workers) {
+    return [workers](Channel<Msg>& source, Channel<Msg>& sink) {
+        auto threads = make_shared<vector<thread>>();
+        auto running = make_shared<atomic<size_t>>(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            threads->emplace_back([&source, &sink, running]() {
+                while (auto m = source.receive()) sink.send(crunch(*m));
+                if (running->fetch_sub(1) == 1) sink.close();
+            });
+        }
+        return [threads]() {
+            for (auto& t : *threads) t.join();
+        };
+    };
+}
+
+auto pipeline_parallel(size_t workers, StageOrder order) {
+    return [workers, order](Channel<Msg>& source, Channel<Msg>& sink) {
+        auto run = make_shared<PipelineRun>(Pipeline<Msg>::from(source).map(crunch, workers, order).to(sink));
+        return [run]() { run->join(); };
+    };
+}
+
+int main(int argc, char** argv) {
+    bench::Reporter reporter(argc, argv);
+    auto run = [&](const string& name, auto&& scenario) {
+        if (reporter.enabled(name)) reporter.report(scenario());
+    };
+
+    run("three_stages_hand_wired", [] { return run_pipeline("three_stages_hand_wired", 500000, hand_wired_three_stages); });
+    run("three_stages_fused", [] { return run_pipeline("three_stages_fused", 500000, fused_three_stages); });
+
+    run("parallel_map_4_hand_wired", [] { return run_pipeline("parallel_map_4_hand_wired", 200000, hand_wired_parallel(4)); });
+    run("parallel_map_4_any", [] { return run_pipeline("parallel_map_4_any", 200000, pipeline_parallel(4, StageOrder::Any)); });
+    run("parallel_map_4_preserve",
+        [] { return run_pipeline("parallel_map_4_preserve", 200000, pipeline_parallel(4, StageOrder::Preserve)); });
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "mpmc_ring.hpp"
+#include "wait_strategy.hpp"
+
+/**
+ * @file broadcast_channel.hpp
+ * @brief Declaration of a fan-out channel: every subscriber receives every item, from one shared ring.
+ *
+ * @details
+ * A BroadcastChannel<T> stores each sent item once. Subscribers each keep their own read cursor
+ * into the ring and copy items out, so the cost of a send does not grow with the number of
+ * subscribers. Each slot counts the subscribers that have yet to read it; the last one moves the
+ * value out instead of copying it and frees the slot for the producers.
+ *
+ * Slots carry a stamp, `4 * position + state`, so a subscriber can tell from one load whether
+ * its next position is published yet, or was already overwritten. Subscribers never take a lock
+ * unless they have to sleep. Producers publish under one mutex, which also orders subscribe and
+ * unsubscribe against publication so the per-slot counts stay exact.
+ *
+ * What happens when the slowest subscriber falls a full ring behind is set by BroadcastPolicy.
+ *
+ * @note A Subscriber is used by one thread at a time and must not outlive its channel.
+ *
+ * @tparam T The type of messages passed through the channel. Must be copy-constructible.
+ */
+
+/**
+ * @brief What a send does when the slot it needs still holds an item some subscriber has not read.
+ */
+enum class BroadcastPolicy {
+    Block,       // Wait for the slowest subscriber; nothing is lost
+    DropOldest,  // Overwrite; a lagging subscriber silently skips to the oldest retained item
+    Lagged,      // Overwrite; a lagging subscriber's next receive throws BroadcastLagged, then resumes
+};
+
+/**
+ * @brief Thrown by a BroadcastPolicy::Lagged subscriber's receive after items it had not read were overwritten.
+ *
+ * The subscriber has already been moved to the oldest retained item, so receiving again continues from there.
+ */
+class BroadcastLagged : public std::runtime_error {
+   public:
+    explicit BroadcastLagged(std::size_t skipped)
+        : std::runtime_error("Broadcast subscriber lagged behind and missed " + std::to_string(skipped) + " items"),
+          skipped_(skipped) {}
+
+    /**
+     * @brief Number of items overwritten before this subscriber could read them.
+     */
+    std::size_t skipped() const { return skipped_; }
+
+   private:
+    std::size_t skipped_;
+};
+
+template <typename T>
+class BroadcastChannel {
+   public:
+    class Subscriber;
+
+    /**
+     * @brief Constructs a broadcast channel.
+     * @param capacity Number of items retained for the slowest subscriber. Must be greater than 0.
+     * @param policy What a send does when the slowest subscriber is a full ring behind.
+     * @throws invalid_argument if capacity is 0.
+     */
+    explicit BroadcastChannel(std::size_t capacity, BroadcastPolicy policy = BroadcastPolicy::Block);
+
+    ~BroadcastChannel();
+
+    BroadcastChannel(const BroadcastChannel &) = delete;
+    BroadcastChannel &operator=(const BroadcastChannel &) = delete;
+
+    /**
+     * @brief Adds a subscriber. It receives every item sent from now on.
+     */
+    Subscriber subscribe();
+
+    /**
+     * @brief Sends one item to every current subscriber. With no subscribers the item is dropped.
+     *
+     * Under BroadcastPolicy::Block, waits while the slowest subscriber is a full ring behind.
+     * @param value The value to send.
+     * @throws runtime_error if the channel is closed.
+     */
+    void send(const T &value);
+    void send(T &&value);
+
+    /**
+     * @brief Non-blocking send.
+     * @param value The value to send. Left untouched if the send fails.
+     * @return false if the channel is closed, or under BroadcastPolicy::Block if the slowest subscriber is a full ring behind.
+     */
+    bool try_send(const T &value);
+    bool try_send(T &&value);
+
+    /**
+     * @brief Closes the channel. Further sends fail; subscribers still receive what they have not read.
+     */
+    void close();
+
+    /**
+     * @brief Checks if the channel is closed.
+     */
+    bool is_closed() const;
+
+    /**
+     * @brief Number of items retained for the slowest subscriber.
+     */
+    std::size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Number of live subscribers.
+     */
+    std::size_t subscriber_count() const;
+
+    BroadcastPolicy policy() const { return policy_; }
+
+   private:
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    // Slot stamp states; the stamp is 4 * position + state
+    static constexpr std::uint64_t slot_free = 0;  // Empty, ready for `position`
+    static constexpr std::uint64_t slot_full = 1;  // Holds the item sent at `position`
+    static constexpr std::uint64_t slot_busy = 2;  // Being emptied or overwritten
+
+    static constexpr std::uint64_t stamp(std::uint64_t position, std::uint64_t state) { return position * 4 + state; }
+
+    enum class ReadResult { Value, Empty, Lagged };
+
+    struct alignas(channel_detail::cache_line_size) Slot {
+        std::atomic<std::uint64_t> stamp;
+        std::atomic<std::size_t> pending{0};    // Subscribers that have yet to read the item
+        std::atomic<std::uint32_t> readers{0};  // Subscribers inside read() on this slot
+        Storage storage;
+
+        T *value() { return std::launder(reinterpret_cast<T *>(&storage)); }
+    };
+
+    Slot &slot(std::uint64_t position) { return slots_[position % capacity_]; }
+
+    // Publishes at tail_ if the policy allows; only consumes value when it succeeds. Caller holds mtx
+    template <typename U>
+    bool publish(U &&value);
+
+    template <typename U>
+    void blocking_send(U &&value);
+
+    template <typename U>
+    bool non_blocking_send(U &&value);
+
+    // Copies, or moves if this is the last reader, the item at `position`
+    ReadResult read(std::uint64_t position, std::optional<T> &out);
+
+    // Drops one reference to the item at `position`; returns true if that emptied the slot
+    bool release(Slot &s, std::uint64_t position);
+
+    // Destroys the item of a slot nobody references any more, unless a producer is already overwriting it
+    bool reclaim(Slot &s, std::uint64_t position);
+
+    void unsubscribe(std::uint64_t cursor);
+
+    void wake_readers();
+    void wake_writers();
+
+    // Read-only after construction
+    alignas(channel_detail::cache_line_size) std::unique_ptr<Slot[]> slots_;
+    std::size_t capacity_;
+    BroadcastPolicy policy_;
+
+    // Producer side, written under mtx
+    alignas(channel_detail::cache_line_size) std::atomic<std::uint64_t> tail_{0};  // Next position to publish
+    std::size_t subscribers_ = 0;
+    std::atomic<bool> closed_{false};
+    std::atomic<std::size_t> waiting_writers_{0};
+    mutable std::mutex mtx;
+    std::condition_variable cv_writers_;  // Notifies producers when the slowest subscriber frees a slot
+
+    // Subscriber side, only touched when a subscriber has to sleep
+    alignas(channel_detail::cache_line_size) std::atomic<std::size_t> waiting_readers_{0};
+    std::mutex read_mtx_;
+    std::condition_variable cv_readers_;  // Notifies subscribers when an item is published
+};
+
+/**
+ * @brief A subscriber's handle: its read cursor into the channel. Unsubscribes on destruction.
+ */
+template <typename T>
+class BroadcastChannel<T>::Subscriber {
+   public:
+    Subscriber(Subscriber &&other) noexcept;
+    Subscriber &operator=(Subscriber &&other) noexcept;
+    ~Subscriber();
+
+    Subscriber(const Subscriber &) = delete;
+    Subscriber &operator=(const Subscriber &) = delete;
+
+    /**
+     * @brief Blocking receive. Waits until an item this subscriber has not read is published.
+     * @return The next item; std::nullopt if the channel is closed and this subscriber has read everything.
+     * @throws BroadcastLagged under BroadcastPolicy::Lagged if items were overwritten before this subscriber read them.
+     */
+    std::optional<T> receive();
+
+    /**
+     * @brief Non-blocking receive.
+     * @return The next item if one is published, otherwise std::nullopt.
+     * @throws BroadcastLagged under BroadcastPolicy::Lagged if items were overwritten before this subscriber read them.
+     */
+    std::optional<T> try_receive();
+
+    /**
+     * @brief Number of items published but not yet read by this subscriber (at most the capacity).
+     */
+    std::size_t len() const;
+
+    /**
+     * @brief Total number of items this subscriber skipped because they were overwritten.
+     */
+    std::size_t missed() const { return missed_; }
+
+    /**
+     * @brief Leaves the channel early; items this subscriber had not read stop waiting for it.
+     */
+    void unsubscribe();
+
+    bool subscribed() const { return channel_ != nullptr; }
+
+   private:
+    friend class BroadcastChannel;
+
+    Subscriber(BroadcastChannel *channel, std::uint64_t cursor) : channel_(channel), cursor_(cursor) {}
+
+    BroadcastChannel *channel_;
+    std::uint64_t cursor_;  // Next position to read
+    std::size_t missed_ = 0;
+};
+
+#include "broadcast_channel.tpp"
@@ -0,0 +1,343 @@
+#pragma once
+
+// Constructor - Stamp every slot free for its first position
+template <typename T>
+BroadcastChannel<T>::BroadcastChannel(std::size_t capacity, BroadcastPolicy policy)
+    : capacity_(capacity), policy_(policy) {
+    if (capacity == 0) {
+        throw std::invalid_argument("BroadcastChannel capacity must be greater than 0");
+    }
+
+    slots_.reset(new Slot[capacity]);
+    for (std::size_t i = 0; i < capacity; i++) {
+        slots_[i].stamp.store(stamp(i, slot_free), std::memory_order_relaxed);
+    }
+}
+
+// Destructor - Destroy items some subscriber never read
+template <typename T>
+BroadcastChannel<T>::~BroadcastChannel() {
+    for (std::size_t i = 0; i < capacity_; i++) {
+        if ((slots_[i].stamp.load(std::memory_order_relaxed) & 3) == slot_full) slots_[i].value()->~T();
+    }
+}
+
+// Subscribe - Start at the tail, so the new subscriber is counted in exactly the items published after it
+template <typename T>
+typename BroadcastChannel<T>::Subscriber BroadcastChannel<T>::subscribe() {
+    std::lock_guard<std::mutex> lock(mtx);
+    subscribers_++;
+    return Subscriber(this, tail_.load(std::memory_order_relaxed));
+}
+
+// Unsubscribe - Drop this subscriber's reference on everything it has not read
+template <typename T>
+void BroadcastChannel<T>::unsubscribe(std::uint64_t cursor) {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+    std::uint64_t oldest = tail > capacity_ ? tail - capacity_ : 0;
+
+    // Producers are held off by the lock, and our own reference keeps the slots from being reclaimed under us
+    bool reclaimed = false;
+    for (std::uint64_t position = std::max(cursor, oldest); position < tail; position++) {
+        Slot &s = slot(position);
+        if (s.stamp.load(std::memory_order_acquire) == stamp(position, slot_full)) {
+            reclaimed = release(s, position) || reclaimed;
+        }
+    }
+    subscribers_--;
+
+    if (reclaimed) cv_writers_.notify_all();
+}
+
+// Publish - Write the item once, with a reference for every current subscriber
+template <typename T>
+template <typename U>
+bool BroadcastChannel<T>::publish(U &&value) {
+    std::uint64_t position = tail_.load(std::memory_order_relaxed);
+    Slot &s = slot(position);
+    const std::uint64_t unread = stamp(position - capacity_, slot_full);  // The item this slot held a lap ago
+
+    for (std::uint32_t round = 0;; round++) {
+        std::uint64_t current = s.stamp.load(std::memory_order_acquire);
+        if (current == stamp(position, slot_free)) break;
+        if (policy_ == BroadcastPolicy::Block) return false;  // The slowest subscriber has not read it yet
+
+        if (current == unread &&
+            s.stamp.compare_exchange_strong(current, stamp(position, slot_busy), std::memory_order_seq_cst)) {
+            // Overwrite - Lagging subscribers now see a newer stamp; wait out any that are copying the item
+            for (std::uint32_t wait = 0; s.readers.load(std::memory_order_seq_cst) != 0; wait++) {
+                channel_detail::spin_pause(wait);
+            }
+            s.value()->~T();
+            break;
+        }
+        channel_detail::spin_pause(round);  // Its last reader is destroying the item
+    }
+
+    if (subscribers_ == 0) {
+        s.stamp.store(stamp(position + capacity_, slot_free), std::memory_order_release);  // Nobody to deliver to
+    } else {
+        ::new (&s.storage) T(std::forward<U>(value));
+        s.pending.store(subscribers_, std::memory_order_relaxed);
+        s.stamp.store(stamp(position, slot_full), std::memory_order_release);
+    }
+    tail_.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+// Non-blocking Send
+template <typename T>
+bool BroadcastChannel<T>::try_send(const T &value) {
+    return non_blocking_send(value);
+}
+
+template <typename T>
+bool BroadcastChannel<T>::try_send(T &&value) {
+    return non_blocking_send(std::move(value));
+}
+
+template <typename T>
+template <typename U>
+bool BroadcastChannel<T>::non_blocking_send(U &&value) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (closed_.load(std::memory_order_relaxed) || !publish(std::forward<U>(value))) return false;
+
+    lock.unlock();
+    wake_readers();
+    return true;
+}
+
+// Blocking Send
+template <typename T>
+void BroadcastChannel<T>::send(const T &value) {
+    blocking_send(value);
+}
+
+template <typename T>
+void BroadcastChannel<T>::send(T &&value) {
+    blocking_send(std::move(value));
+}
+
+template <typename T>
+template <typename U>
+void BroadcastChannel<T>::blocking_send(U &&value) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (closed_.load(std::memory_order_relaxed)) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+
+    // Slow path (Block only): park until the slowest subscriber frees the slot or the channel closes
+    if (!publish(std::forward<U>(value))) {
+        waiting_writers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool published = false;
+        cv_writers_.wait(lock, [&]() {
+            if (closed_.load(std::memory_order_relaxed)) return true;
+            published = publish(std::forward<U>(value));  // Only consumes value when it succeeds
+            return published;
+        });
+        waiting_writers_.fetch_sub(1, std::memory_order_relaxed);
+
+        if (!published) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+    }
+
+    lock.unlock();
+    wake_readers();
+}
+
+// Read - Announce ourselves on the slot before checking its stamp, so an overwriting producer waits for the copy
+template <typename T>
+typename BroadcastChannel<T>::ReadResult BroadcastChannel<T>::read(std::uint64_t position, std::optional<T> &out) {
+    Slot &s = slot(position);
+    s.readers.fetch_add(1, std::memory_order_seq_cst);
+    std::uint64_t current = s.stamp.load(std::memory_order_seq_cst);
+
+    if (current != stamp(position, slot_full)) {
+        s.readers.fetch_sub(1, std::memory_order_release);
+        return current < stamp(position, slot_full) ? ReadResult::Empty : ReadResult::Lagged;
+    }
+
+    bool reclaimed;
+    try {
+        std::size_t last = 1;
+        if (s.pending.load(std::memory_order_acquire) == 1 &&
+            s.pending.compare_exchange_strong(last, 0, std::memory_order_acq_rel)) {
+            out.emplace(std::move(*s.value()));  // Everyone else has read it
+            reclaimed = reclaim(s, position);
+        } else {
+            out.emplace(*s.value());
+            reclaimed = release(s, position);
+        }
+    } catch (...) {
+        s.readers.fetch_sub(1, std::memory_order_release);  // Copy threw; the item stays unread
+        throw;
+    }
+    s.readers.fetch_sub(1, std::memory_order_release);
+
+    if (reclaimed && policy_ == BroadcastPolicy::Block) wake_writers();
+    return ReadResult::Value;
+}
+
+template <typename T>
+bool BroadcastChannel<T>::release(Slot &s, std::uint64_t position) {
+    if (s.pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return false;
+    return reclaim(s, position);
+}
+
+// Reclaim - A producer that already started overwriting the slot destroys the item itself
+template <typename T>
+bool BroadcastChannel<T>::reclaim(Slot &s, std::uint64_t position) {
+    std::uint64_t expected = stamp(position, slot_full);
+    if (!s.stamp.compare_exchange_strong(expected, stamp(position, slot_busy), std::memory_order_acq_rel,
+                                         std::memory_order_relaxed)) {
+        return false;
+    }
+    s.value()->~T();
+    s.stamp.store(stamp(position + capacity_, slot_free), std::memory_order_release);
+    return true;
+}
+
+// Wake parked subscribers - Pairs with the fence in Subscriber::receive()'s slow path
+template <typename T>
+void BroadcastChannel<T>::wake_readers() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_readers_.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(read_mtx_);
+    cv_readers_.notify_all();
+}
+
+// Wake parked producers - Pairs with the fence in send()'s slow path
+template <typename T>
+void BroadcastChannel<T>::wake_writers() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_writers_.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    cv_writers_.notify_all();
+}
+
+// Close the channel
+template <typename T>
+void BroadcastChannel<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (closed_.load(std::memory_order_relaxed)) return;  // Already closed
+
+        closed_.store(true, std::memory_order_release);
+        cv_writers_.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock(read_mtx_);
+    cv_readers_.notify_all();
+}
+
+// Check closed state
+template <typename T>
+bool BroadcastChannel<T>::is_closed() const {
+    return closed_.load(std::memory_order_acquire);
+}
+
+template <typename T>
+std::size_t BroadcastChannel<T>::subscriber_count() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return subscribers_;
+}
+
+// Subscriber - Move
+template <typename T>
+BroadcastChannel<T>::Subscriber::Subscriber(Subscriber &&other) noexcept
+    : channel_(std::exchange(other.channel_, nullptr)), cursor_(other.cursor_), missed_(other.missed_) {}
+
+template <typename T>
+typename BroadcastChannel<T>::Subscriber &BroadcastChannel<T>::Subscriber::operator=(Subscriber &&other) noexcept {
+    if (this != &other) {
+        unsubscribe();
+        channel_ = std::exchange(other.channel_, nullptr);
+        cursor_ = other.cursor_;
+        missed_ = other.missed_;
+    }
+    return *this;
+}
+
+template <typename T>
+BroadcastChannel<T>::Subscriber::~Subscriber() {
+    unsubscribe();
+}
+
+template <typename T>
+void BroadcastChannel<T>::Subscriber::unsubscribe() {
+    if (!channel_) return;
+    channel_->unsubscribe(cursor_);
+    channel_ = nullptr;
+}
+
+// Subscriber - Non-blocking receive; a lagging cursor jumps to the oldest item still retained
+template <typename T>
+std::optional<T> BroadcastChannel<T>::Subscriber::try_receive() {
+    if (!channel_) return std::nullopt;
+
+    std::optional<T> value;
+    while (true) {
+        switch (channel_->read(cursor_, value)) {
+            case ReadResult::Value:
+                cursor_++;
+                return value;
+            case ReadResult::Empty:
+                return std::nullopt;
+            case ReadResult::Lagged:
+                break;
+        }
+
+        // Everything before tail - capacity has been overwritten; the item at cursor_ is at least being overwritten
+        std::uint64_t tail = channel_->tail_.load(std::memory_order_acquire);
+        std::uint64_t oldest = tail > channel_->capacity_ ? tail - channel_->capacity_ : 0;
+        std::uint64_t next = std::max(cursor_ + 1, oldest);
+        std::size_t skipped = next - cursor_;
+        cursor_ = next;
+        missed_ += skipped;
+
+        if (channel_->policy_ == BroadcastPolicy::Lagged) throw BroadcastLagged(skipped);
+    }
+}
+
+// Subscriber - Blocking receive
+template <typename T>
+std::optional<T> BroadcastChannel<T>::Subscriber::receive() {
+    if (!channel_) return std::nullopt;
+
+    // Fast path: an unread item is already published
+    if (auto value = try_receive()) return value;
+
+    // Slow path: park until a producer publishes or the channel closes
+    BroadcastChannel &ch = *channel_;
+    std::unique_lock<std::mutex> lock(ch.read_mtx_);
+    ch.waiting_readers_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::optional<T> value;
+    try {
+        ch.cv_readers_.wait(lock, [&]() {
+            bool closed = ch.closed_.load(std::memory_order_acquire);  // Before reading: a close seen here follows every publish
+            if (auto next = try_receive()) value.emplace(std::move(*next));
+            return value.has_value() || closed;
+        });
+    } catch (...) {
+        ch.waiting_readers_.fetch_sub(1, std::memory_order_relaxed);  // BroadcastLagged
+        throw;
+    }
+    ch.waiting_readers_.fetch_sub(1, std::memory_order_relaxed);
+    return value;
+}
+
+// Subscriber - Unread item count; a lagging cursor can trail by more than the ring retains
+template <typename T>
+std::size_t BroadcastChannel<T>::Subscriber::len() const {
+    if (!channel_) return 0;
+    std::uint64_t tail = channel_->tail_.load(std::memory_order_acquire);
+    return static_cast<std::size_t>(std::min<std::uint64_t>(tail - cursor_, channel_->capacity_));
+}
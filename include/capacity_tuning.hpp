@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+/**
+ * @file capacity_tuning.hpp
+ * @brief Runtime-resizable channel capacity, and an optional tuner that resizes from observed blocking.
+ *
+ * @details
+ * A Channel<T> constructed from ResizableCapacity keeps its items in a segmented queue (see
+ * segmented_queue.hpp) and admits senders through a counter checked against the current
+ * capacity, so set_capacity() takes effect at once: growing wakes blocked senders, shrinking
+ * keeps whatever is already buffered and only holds back new sends until the depth falls below
+ * the new capacity. Memory follows the depth rather than the capacity, since blocks are released
+ * as they drain.
+ *
+ * With a CapacityTuning attached, the channel resizes itself, on the thread that just waited:
+ *  - Time senders spend blocked for room is summed per window; once it reaches `grow_after` the
+ *    capacity doubles and a new window starts.
+ *  - A receiver that has to wait for data when no sender has blocked for a whole window, and the
+ *    last step is at least a window old, halves it.
+ * Both steps stay within [min_capacity, max_capacity].
+ */
+
+/**
+ * @brief Automatic resizing policy for a resizable channel.
+ */
+struct CapacityTuning {
+    std::size_t min_capacity = 1;
+    std::size_t max_capacity = 1 << 20;
+    std::chrono::nanoseconds grow_after = std::chrono::microseconds(200);  // Blocked-sender time per window that doubles the capacity
+    std::chrono::nanoseconds window = std::chrono::milliseconds(100);      // Observation window; also the minimum time between steps
+};
+
+/**
+ * @brief Capacity argument for a buffered channel whose capacity can change at runtime.
+ */
+struct ResizableCapacity {
+    std::size_t initial;                  // Starting capacity; must be greater than 0
+    std::optional<CapacityTuning> tuning;  // Resize automatically (nullopt: only through set_capacity())
+};
+
+namespace channel_detail {
+
+// Bookkeeping behind CapacityTuning; the channel reports its waits and applies the answers
+class CapacityTuner {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CapacityTuner(const CapacityTuning &tuning)
+        : tuning_(tuning), window_start_(Clock::now()), last_sender_block_(window_start_), last_step_(window_start_) {}
+
+    // A sender waited `blocked` for room; returns the capacity to grow to, if it is time
+    std::optional<std::size_t> sender_blocked(Clock::duration blocked, std::size_t capacity) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto now = Clock::now();
+        if (now - window_start_ >= tuning_.window) {
+            window_start_ = now;
+            blocked_in_window_ = Clock::duration::zero();
+        }
+        blocked_in_window_ += blocked;
+        last_sender_block_ = now;
+
+        if (blocked_in_window_ < tuning_.grow_after || capacity >= tuning_.max_capacity) return std::nullopt;
+
+        // Start a fresh window, so the next step needs new evidence
+        window_start_ = last_step_ = now;
+        blocked_in_window_ = Clock::duration::zero();
+        return capacity > tuning_.max_capacity / 2 ? tuning_.max_capacity : std::max(capacity * 2, tuning_.min_capacity);
+    }
+
+    // A receiver waited for data; returns the capacity to shrink to, if senders have been idle for a window
+    std::optional<std::size_t> receiver_waited(std::size_t capacity) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto now = Clock::now();
+        if (capacity <= tuning_.min_capacity || now - last_sender_block_ < tuning_.window ||
+            now - last_step_ < tuning_.window) {
+            return std::nullopt;
+        }
+        last_step_ = now;
+        return std::max(capacity / 2, tuning_.min_capacity);
+    }
+
+   private:
+    const CapacityTuning tuning_;
+    std::mutex mtx_;
+    Clock::time_point window_start_;
+    Clock::duration blocked_in_window_ = Clock::duration::zero();
+    Clock::time_point last_sender_block_;
+    Clock::time_point last_step_;
+};
+
+}  // namespace channel_detail
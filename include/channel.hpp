@@ -1,11 +1,30 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <future>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
-#include <queue>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "capacity_tuning.hpp"
+#include "channel_buffer.hpp"
+#include "channel_metrics.hpp"
+#include "coro.hpp"
+#include "executor.hpp"
+#include "send_gate.hpp"
+#include "wait_queue.hpp"
+#include "wait_strategy.hpp"
 
 /**
  * @file channel.hpp
@@ -15,9 +34,33 @@
  * This Channel<T> implementation supports:
  *  - Buffered and unbuffered channels.
  *  - Blocking and non-blocking send/receive.
- *  - Async send/receive using std::future.
+ *  - Async send/receive using std::future or a completion callback.
+ *  - co_await-able send/receive when built as C++20 (see coro.hpp).
  *  - Close semantics (no more sends allowed).
- *  - Optional integration with Select<T> through notifier registration.
+ *  - Select integration: a blocked select parks one waiter per case on the channel, and the
+ *    channel fires the waiter of the case that became ready.
+ *
+ * Buffered channels store their items in a lock-free MPMC ring (see mpmc_ring.hpp). Send and
+ * receive only fall back to the mutex and condition variables when the ring is full or empty
+ * and the caller has to block. An unbounded channel (capacity Channel<T>::unbounded) keeps its
+ * items in a lock-free queue of linked blocks instead (see segmented_queue.hpp), so its sends
+ * never block; set_high_water_mark() reports when it grows past a soft limit. A bounded buffer
+ * can also be made lossy with an OverflowPolicy, so senders never wait for slow receivers.
+ *
+ * Unbuffered channels rendezvous like Go's: a sender or receiver with no counterpart parks a
+ * record holding its own value slot on sendq/recvq and sleeps on its own thread's parker. The
+ * counterpart moves the value directly into (or out of) that record and wakes exactly that
+ * thread. try_send() on an unbuffered channel succeeds exactly when a receiver is parked.
+ *
+ * A blocking operation that has to wait either parks straight away or, with a spinning
+ * WaitStrategy (see wait_strategy.hpp), first polls for its counterpart without sleeping.
+ *
+ * Building with CHANNEL_ENABLE_METRICS=1 adds per-channel counters (see channel_metrics.hpp).
+ *
+ * Async operations never occupy a thread while they are pending. An async send or receive that
+ * cannot complete immediately is parked on the channel as a waiter record, and the peer operation
+ * that matches it completes the record directly. Futures are fulfilled on the peer's thread;
+ * completion callbacks are handed to the channel's Executor (see executor.hpp).
  *
  * @note Thread-safe: All public methods are safe for concurrent access
  *       from multiple producer and multiple consumer threads.
@@ -25,21 +68,83 @@
  * @tparam T The type of messages passed through the channel.
  */
 
+/**
+ * @brief What a send does when a buffered channel's buffer is full.
+ *
+ * The lossy policies never make a sender wait. Operations that can report failure (try_send(),
+ * send_for(), send_until()) do so under DropNewest instead of dropping; everything the channel
+ * discards is counted by Channel<T>::dropped().
+ */
+enum class OverflowPolicy {
+    Block,       // Wait for a receiver to free a slot (the default)
+    DropNewest,  // Discard the value being sent
+    DropOldest,  // Evict the oldest buffered value to make room
+    KeepLatest,  // One conflating slot: each send replaces the value not yet received
+};
+
 template <typename T>
 class Channel {
    public:
+    // Capacity of a channel whose buffer grows as needed; send() on it never blocks
+    static constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+
     /**
      * @brief Constructs a Channel with optional buffering.
-     * @param buffer_size Size of internal buffer. Set to 0 for unbuffered channel.
+     * @param buffer_size Size of internal buffer. Set to 0 for unbuffered channel, or to
+     *                    Channel<T>::unbounded for a buffer that grows without limit.
+     * @param wait_strategy How blocking send/receive wait for a counterpart. Defaults to parking at once.
+     * @param resource Supplies the ring (allocated in full here) or the unbounded queue's blocks,
+     *                 and every async record and future state. Must outlive the channel and any
+     *                 async operation still completing. Pass a pool such as
+     *                 std::pmr::synchronized_pool_resource to keep a steady workload off the global heap.
      */
-    explicit Channel(std::size_t buffer_size = 0);
+    explicit Channel(std::size_t buffer_size = 0, WaitStrategy wait_strategy = WaitStrategy::block(),
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Constructs a buffered channel with an overflow policy for when its buffer is full.
+     * @param buffer_size Size of the buffer; must be 1 for OverflowPolicy::KeepLatest.
+     * @param overflow What a send on a full buffer does.
+     * @throws invalid_argument if buffer_size is 0, or not 1 with OverflowPolicy::KeepLatest.
+     */
+    Channel(std::size_t buffer_size, OverflowPolicy overflow, WaitStrategy wait_strategy = WaitStrategy::block(),
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Constructs a buffered channel whose capacity can change later (see set_capacity()).
+     * Its items live in a segmented queue, so memory follows the number of buffered items.
+     * @param capacity Initial capacity, and an optional CapacityTuning to resize automatically.
+     * @throws invalid_argument if the initial capacity is 0.
+     */
+    explicit Channel(ResizableCapacity capacity, WaitStrategy wait_strategy = WaitStrategy::block(),
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Destroys the channel. Pending async operations complete as if the channel was closed.
+     */
+    ~Channel();
+
+    Channel(const Channel &) = delete;
+    Channel &operator=(const Channel &) = delete;
 
     /**
      * @brief Blocking send. Waits until the value is accepted by a receiver.
-     * @param value The value to send.
+     * With a lossy OverflowPolicy it never waits; a full buffer is handled by the policy.
+     * @param value The value to send. The rvalue overload moves it into the channel.
      * @throws runtime_error if the channel is closed.
      */
     void send(const T &value);  // Blocking send
+    void send(T &&value);
+
+    /**
+     * @brief Blocking send that constructs the value in place from `args`.
+     * @param args Constructor arguments for T. Buffered channels only consume them once a slot is
+     *             free, unless the constructor may throw: then the value is built once, up front.
+     *             Unbuffered channels build the value when the sender parks for a receiver.
+     * @throws runtime_error if the channel is closed.
+     */
+    template <typename... Args>
+    void emplace(Args &&...args);
 
     /**
      * @brief Blocking receive. Waits for a value if the channel is not empty.
@@ -47,12 +152,47 @@ class Channel {
      */
     std::optional<T> receive();
 
+    /**
+     * @brief Send that gives up after `timeout`.
+     * @param value The value to send. The rvalue overload only moves from it if the send succeeds.
+     * @param timeout How long to wait for a free slot (buffered) or a receiver (unbuffered).
+     * @return true if the value was sent, false if the timeout expired first.
+     * @throws runtime_error if the channel is closed before the value was accepted.
+     */
+    template <typename Rep, typename Period>
+    bool send_for(const T &value, const std::chrono::duration<Rep, Period> &timeout);
+    template <typename Rep, typename Period>
+    bool send_for(T &&value, const std::chrono::duration<Rep, Period> &timeout);
+
+    /**
+     * @brief Send that gives up at `deadline`. See send_for().
+     */
+    template <typename Clock, typename Duration>
+    bool send_until(const T &value, const std::chrono::time_point<Clock, Duration> &deadline);
+    template <typename Clock, typename Duration>
+    bool send_until(T &&value, const std::chrono::time_point<Clock, Duration> &deadline);
+
+    /**
+     * @brief Receive that gives up after `timeout`. Costs the same as receive() when a value is ready.
+     * @return A received value, or std::nullopt if the timeout expired or the channel is closed and empty.
+     */
+    template <typename Rep, typename Period>
+    std::optional<T> receive_for(const std::chrono::duration<Rep, Period> &timeout);
+
+    /**
+     * @brief Receive that gives up at `deadline`. See receive_for().
+     */
+    template <typename Clock, typename Duration>
+    std::optional<T> receive_until(const std::chrono::time_point<Clock, Duration> &deadline);
+
     /**
      * @brief Non-blocking send.
-     * @param value The value to send.
+     * @param value The value to send. The rvalue overload only moves from it on success,
+     *              so a failed try_send leaves the caller's value untouched.
      * @return true if the value was accepted, false if channel is full or closed.
      */
     bool try_send(const T &value);
+    bool try_send(T &&value);
 
     /**
      * @brief Non-blocking receive.
@@ -60,12 +200,84 @@ class Channel {
      */
     std::optional<T> try_receive();
 
+    /**
+     * @brief Blocking batch send. Sends every element of [first, last) in order.
+     *
+     * Buffered channels move as many elements as currently fit into the buffer in one claim
+     * and wake receivers once per chunk rather than once per element. Wrap the range in
+     * std::make_move_iterator to move the elements instead of copying them.
+     *
+     * @param first Iterator to the first element.
+     * @param last Iterator past the last element.
+     * @throws runtime_error if the channel is closed before every element was sent.
+     */
+    template <typename ForwardIt>
+    void send_batch(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief Blocking batch send of `n` elements starting at `first`. See send_batch().
+     */
+    template <typename ForwardIt>
+    void send_n(ForwardIt first, std::size_t n);
+
+    /**
+     * @brief Blocking batch receive. Waits for at least one element, then takes up to `max`.
+     * @param out Output iterator the received values are moved into.
+     * @param max Maximum number of elements to receive.
+     * @return Number of elements received; 0 only if the channel is closed and empty.
+     */
+    template <typename OutputIt>
+    std::size_t receive_batch(OutputIt out, std::size_t max);
+
+    /**
+     * @brief Non-blocking batch receive. Takes up to `max` elements that are available right now.
+     * @param out Output iterator the received values are moved into.
+     * @param max Maximum number of elements to receive.
+     * @return Number of elements received, possibly 0.
+     */
+    template <typename OutputIt>
+    std::size_t try_receive_batch(OutputIt out, std::size_t max);
+
+    // Most items one Iterator refill takes out of the channel
+    static constexpr std::size_t iteration_chunk = 64;
+
+    class Iterator;
+
+    /**
+     * @brief Receives through an input iterator, so `for (auto &&v : ch)` drains the channel until
+     * it is closed and empty.
+     *
+     * The iterator refills with receive_batch(): it waits for one item, then takes everything
+     * else that is buffered (up to iteration_chunk) in one claim, so a busy channel costs one
+     * claim and one wakeup per chunk rather than per item. Items in the chunk are already
+     * received: leaving the loop early discards whatever is left of the current chunk, and
+     * other receivers never see it.
+     *
+     * @return An iterator positioned on the first received item, or end() if the channel is
+     *         closed and empty.
+     */
+    Iterator begin();
+    Iterator end();
+
     /**
      * @brief Asynchronously sends a value.
-     * @param value The value to send.
-     * @return A future that completes when the value is sent.
+     * @param value The value to send. The rvalue overload moves it into the pending operation.
+     * @return A future that completes when the value is sent, or holds a runtime_error if the
+     *         channel is closed first.
      */
     std::future<void> async_send(const T &value);
+    std::future<void> async_send(T &&value);
+
+    /**
+     * @brief Asynchronously sends a value and reports the outcome through a callback.
+     * @param value The value to send.
+     * @param on_complete Called as `on_complete(bool sent)` on the channel's executor; `sent` is
+     *        false if the channel was closed before the value was accepted.
+     */
+    template <typename F>
+    void async_send(const T &value, F &&on_complete);
+    template <typename F>
+    void async_send(T &&value, F &&on_complete);
 
     /**
      * @brief Asynchronously receives a value.
@@ -73,8 +285,102 @@ class Channel {
      */
     std::future<std::optional<T>> async_receive();
 
+    /**
+     * @brief Asynchronously receives a value and hands it to a callback.
+     * @param on_complete Called as `on_complete(std::optional<T>)` on the channel's executor;
+     *        the optional is empty if the channel is closed and empty.
+     */
+    template <typename F>
+    void async_receive(F &&on_complete);
+
+#if CHANNEL_HAS_COROUTINES
+    class ReceiveAwaitable;
+    class SendAwaitable;
+
+    /**
+     * @brief Awaitable receive: `std::optional<T> v = co_await ch.receive_awaitable();`
+     *
+     * If nothing can be received right away the coroutine is suspended and parked on the channel;
+     * the sender (or close()) that completes it resumes it on the CoroScheduler it was running on,
+     * or inline on the completing thread if it was not running on one.
+     *
+     * @return An awaitable resolving to a received value, or nullopt if closed and empty.
+     */
+    ReceiveAwaitable receive_awaitable();
+
+    /**
+     * @brief Awaitable send: `co_await ch.async_send_awaitable(value);`
+     *
+     * Suspends the coroutine until a receiver accepts the value; resumed like receive_awaitable().
+     *
+     * @param value The value to send. The rvalue overload moves it into the awaitable.
+     * @throws runtime_error from the co_await if the channel is closed before the value was accepted.
+     */
+    SendAwaitable async_send_awaitable(const T &value);
+    SendAwaitable async_send_awaitable(T &&value);
+#endif
+
+    /**
+     * @brief Sets the executor that runs completion callbacks. Defaults to default_executor().
+     * @param executor Executor that must outlive every pending callback of this channel.
+     */
+    void set_executor(Executor &executor) {
+        std::lock_guard<std::mutex> lock(mtx);
+        executor_ = &executor;
+    }
+
+    /**
+     * @brief The memory resource this channel allocates from.
+     */
+    std::pmr::memory_resource *memory_resource() const { return resource_; }
+
+    /**
+     * @brief Installs a soft limit on a buffered channel's depth, mainly for unbounded channels.
+     * Nothing is refused: `on_reached(depth)` runs on the sending thread, outside the channel's
+     * lock, once when len() reaches `mark`, and again only after the depth has fallen back to
+     * half of `mark` and climbed to it once more. Install it before the channel is shared.
+     * @param mark Depth that triggers the callback; 0 removes the limit.
+     * @param on_reached Called as `on_reached(std::size_t depth)`; typically starts shedding load.
+     */
+    void set_high_water_mark(std::size_t mark, std::function<void(std::size_t)> on_reached) {
+        high_water_mark_ = mark;
+        high_water_hook_ = std::move(on_reached);
+        high_water_armed_.store(true, std::memory_order_relaxed);
+    }
+
+    OverflowPolicy overflow_policy() const { return overflow_; }
+
+    /**
+     * @brief Number of values the overflow policy has discarded: sends dropped under DropNewest,
+     *        buffered values evicted under DropOldest and KeepLatest. Always zero with Block.
+     */
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief How often the spin phase of a blocking wait succeeded. Always zero with WaitStrategy::block().
+     */
+    WaitStats wait_stats() const {
+        return {spin_successes_.load(std::memory_order_relaxed), spin_failures_.load(std::memory_order_relaxed)};
+    }
+
+#if CHANNEL_ENABLE_METRICS
+    /**
+     * @brief Snapshot of this channel's counters. Only available with CHANNEL_ENABLE_METRICS=1.
+     */
+    ChannelMetrics metrics() const { return metrics_.snapshot(); }
+
+    /**
+     * @brief Reports every blocking wait of this channel as it ends, on the thread that waited.
+     * Install it before the channel is shared. Only available with CHANNEL_ENABLE_METRICS=1.
+     * @param hook Called as `hook(const ChannelWaitEvent &)`; must not block for long.
+     */
+    void set_metrics_hook(std::function<void(const ChannelWaitEvent &)> hook) { metrics_.set_hook(std::move(hook)); }
+#endif
+
     /**
      * @brief Closes the channel. Further sends will fail.
+     * @note Waits for buffered sends already pushing without the lock, so every item a send
+     *       accepted is received before a receiver sees the channel closed and drained.
      */
     void close();
 
@@ -85,59 +391,284 @@ class Channel {
     bool is_closed() const;
 
     /**
-     * @brief Checks if the channel is empty.
+     * @brief Checks if the channel is empty. Lock-free.
      * @return true if empty or unbuffered with no pending data.
      */
     bool empty() const;
 
     /**
-     * @brief Registers a condition_variable to notify when channel state changes.
-     * Useful for implementing select-like functionality.
+     * @brief Number of values buffered right now, like Go's len(ch). Lock-free; 0 for unbuffered channels.
      */
-    void add_notifier(std::condition_variable *cv) {
-        std::lock_guard lock(mtx);
-        notifiers_.push_back(cv);
-    }
+    std::size_t len() const;
 
     /**
-     * @brief Checks whether a receive operation can proceed immediately.
-     * @return true if data is available, false otherwise.
+     * @brief Buffer capacity, like Go's cap(ch); 0 for unbuffered channels, Channel<T>::unbounded for unbounded ones.
      */
-    bool is_receive_ready() {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (buffer_size_ == 0) {  // unbuffered case
-            return has_data_;
-        } else {  // buffered case
-            return !buffer_.empty();
-        }
-    }
+    std::size_t cap() const { return buffer_size_ == 0 ? 0 : buffer_.capacity(); }
+
+    /**
+     * @brief Changes the capacity of a channel constructed from ResizableCapacity. Safe during traffic.
+     * Growing wakes senders blocked for room; shrinking keeps every buffered item, and sends block
+     * until receivers bring len() below the new capacity.
+     * @throws logic_error if the channel is not resizable; invalid_argument if `capacity` is 0.
+     */
+    void set_capacity(std::size_t capacity);
+
+    /**
+     * @brief Parks a select case that fires once a receive could proceed (used by Select).
+     * @param waiter Record owned by the select; stays valid until unwatch() returns.
+     * @return true if a receive could already proceed (or the channel is closed and the waiter has
+     *         fire_on_close set), in which case the waiter is not parked.
+     */
+    bool watch_receive(channel_detail::SelectWaiter *waiter);
+
+    /**
+     * @brief Parks a select case that fires once a send could proceed (used by Select).
+     * @return true if a send could already proceed, in which case the waiter is not parked.
+     */
+    bool watch_send(channel_detail::SelectWaiter *waiter);
+
+    /**
+     * @brief Removes a select case parked by watch_receive()/watch_send() if it has not fired yet.
+     */
+    void unwatch(channel_detail::SelectWaiter *waiter);
+
+    /**
+     * @brief Records that a select this channel woke went on to run its case here (used by Select).
+     */
+    void select_wakeup_used();
+
+    /**
+     * @brief Checks whether a receive operation can proceed immediately. Lock-free.
+     * @return true if data is available (buffered) or a sender is parked (unbuffered), false otherwise.
+     */
+    bool is_receive_ready() const;
+
+    /**
+     * @brief Checks whether a send operation can proceed immediately, without sending anything. Lock-free.
+     * @return true if the channel is open and has a free slot (buffered) or a parked receiver (unbuffered).
+     */
+    bool is_send_ready() const;
 
    private:
-    mutable std::mutex mtx;
-    std::condition_variable cv_sender_;    // Notifies senders when space is available or data is consumed.
-    std::condition_variable cv_receiver_;  // Notifies receivers when data is available.
+    // Parked receive, completed by the sender (or close) that matches it
+    struct RecvWaiter {
+        RecvWaiter *prev = nullptr;
+        RecvWaiter *next = nullptr;
+        std::optional<T> value;                    // Filled by the completing sender; empty if closed
+        void (*complete)(RecvWaiter *) = nullptr;  // Runs after the channel lock is released
+    };
 
-    // For buffered channels
-    std::queue<T> buffer_;
-    std::size_t buffer_size_;  // 0 means unbuffered channel
+    // Parked send, completed by the receiver (or close) that matches it
+    struct SendWaiter {
+        SendWaiter *prev = nullptr;
+        SendWaiter *next = nullptr;
+        std::optional<T> value;                    // Value still to be delivered
+        bool sent = false;                         // false if the channel closed first
+        void (*complete)(SendWaiter *) = nullptr;  // Runs after the channel lock is released
+    };
 
-    // For unbuffered channels, we use an optional to hold the data.
-    std::optional<T> data_;
-    bool has_data_ = false;
+    // Blocking unbuffered operation: the record sits on the caller's stack and the caller sleeps on
+    // its own thread's Parker, so the counterpart wakes exactly this thread
+    template <typename Waiter>
+    struct Parked : Waiter {
+        channel_detail::Parker *parker = &channel_detail::Parker::current();
+        std::atomic<bool> done{false};
 
-    bool closed_ = false;                // Indicates if the channel is closed
-    std::size_t waiting_receivers_ = 0;  // Used to help with non-blocking send in unbuffered mode
+        Parked() {
+            this->complete = [](Waiter *w) {
+                auto *self = static_cast<Parked *>(w);
+                self->parker->unpark(self->done);
+            };
+        }
 
-    std::vector<std::condition_variable *> notifiers_;  // External notifiers for select-like coordination
+        void wait(Channel &chan) {
+            if (chan.spin_wait([this]() { return done.load(std::memory_order_acquire); })) {
+                parker->settle();
+            } else {
+                parker->park(done);
+            }
+        }
+
+        // Returns false if `deadline` passed first; the record may still be completed after that
+        template <typename Clock, typename Duration>
+        bool wait_until(Channel &chan, const std::chrono::time_point<Clock, Duration> &deadline) {
+            auto finished = [this]() { return done.load(std::memory_order_acquire); };
+            if (chan.spin_wait(finished, channel_detail::DeadlinePoll<Clock, Duration>(deadline))) {
+                parker->settle();
+                return true;
+            }
+            return parker->park_until(done, deadline);
+        }
+    };
+
+    /**
+     * @brief Polls `ready` as wait_strategy_ allows and counts the outcome.
+     * @param expired Ends the spin early without success (used by the timed operations).
+     * @return true if `ready` succeeded while spinning; false if the caller has to park.
+     */
+    template <typename Ready>
+    bool spin_wait(Ready &&ready);
+    template <typename Ready, typename Expired>
+    bool spin_wait(Ready &&ready, Expired &&expired);
 
     /**
-     * @brief Notifies all registered condition variables (e.g., select implementations).
+     * @brief Shared timed send. `deadline_of()` is only called once the fast path has failed.
      */
-    void notify_all_registered() {
-        for (auto cv : notifiers_) {
-            cv->notify_all();
+    template <typename U, typename DeadlineOf>
+    bool send_timed(U &&value, DeadlineOf &&deadline_of);
+
+    /**
+     * @brief Shared timed receive. `deadline_of()` is only called once the fast path has failed.
+     */
+    template <typename DeadlineOf>
+    std::optional<T> receive_timed(DeadlineOf &&deadline_of);
+
+    template <typename... Args>
+    void send_impl(Args &&...args);
+
+    template <typename... Args>
+    bool try_send_impl(Args &&...args);
+
+    /**
+     * @brief try_send()/try_receive() minus the try_* failure count, for the coroutine awaitables:
+     *        a miss there suspends the coroutine instead of failing, so it is not a failed try.
+     */
+    template <typename... Args>
+    bool poll_send(Args &&...args);
+    std::optional<T> poll_receive();
+
+    /**
+     * @brief Lossy channels only: stores a value after a push found the buffer full. Evicting
+     *        policies drop the oldest values until it fits; DropNewest stores nothing. Never blocks.
+     * @return true if the value was stored (args are only consumed then).
+     */
+    template <typename... Args>
+    bool push_overflowing(Args &&...args);
+
+    // Whether a send on a full buffer makes room instead of failing or waiting
+    bool evicts() const { return overflow_ == OverflowPolicy::DropOldest || overflow_ == OverflowPolicy::KeepLatest; }
+
+    /**
+     * @brief Completes a receive record immediately if possible, otherwise parks it on recvq_.
+     * @return true if the record was completed right away; its `complete` was not called and
+     *         the caller finishes it. false if it was parked and will be completed later.
+     */
+    bool submit_receive(RecvWaiter *waiter);
+
+    /**
+     * @brief Completes a send record immediately if possible, otherwise parks it on sendq_.
+     * @return true if the record was completed right away (see submit_receive()).
+     */
+    bool submit_send(SendWaiter *waiter);
+
+    /**
+     * @brief Buffered only: feeds ring items to parked receivers and parked senders' values to the ring.
+     * Caller holds mtx. Completed records are prepended to the given lists.
+     */
+    void settle_locked(RecvWaiter *&done_receivers, SendWaiter *&done_senders);
+
+    /**
+     * @brief Runs the completion of every record in a list built by settle_locked()/close().
+     */
+    template <typename Waiter>
+    static void complete_all(Waiter *list) {
+        while (list) {
+            Waiter *next = list->next;
+            list->complete(list);
+            list = next;
         }
     }
+
+    Executor &executor() const {
+        return executor_ ? *executor_ : default_executor();
+    }
+
+    // The hot state is split into regions that start on their own cache line (see
+    // channel_detail::cache_line_size): read-mostly configuration, the ring (whose head, tail and
+    // slots are already apart), a sender-written line, a receiver-written line, and the lock with
+    // everything it guards. A channel's alignment is therefore a whole line, so neighbouring
+    // channels in an array never share one either.
+
+    // Read-mostly: set at construction (or rarely after), read by every operation
+    alignas(channel_detail::cache_line_size) std::size_t buffer_size_;  // 0 means unbuffered channel
+    const WaitStrategy wait_strategy_;
+    Executor *executor_ = nullptr;                // Runs completion callbacks; nullptr means default_executor()
+    std::pmr::memory_resource *const resource_;   // Ring slots, async records and future states
+    std::atomic<bool> closed_{false};             // Indicates if the channel is closed
+    std::atomic<std::size_t> watcher_count_{0};  // Parked select cases; lets the lock-free path skip them
+    std::size_t high_water_mark_ = 0;            // 0: no soft limit (see set_high_water_mark())
+    OverflowPolicy overflow_ = OverflowPolicy::Block;
+    channel_detail::CapacityTuner *tuner_ = nullptr;  // Resizable channels with a CapacityTuning only
+
+    // For buffered channels: the ring, or the segmented queue of an unbounded or resizable channel
+    channel_detail::ChannelBuffer<T> buffer_;
+
+    // Sender side: written when senders park, only read by receivers deciding whether to wake one
+    alignas(channel_detail::cache_line_size) std::atomic<std::size_t> waiting_senders_{0};  // Senders parked on cv_sender_ or sendq_ (unbuffered: sendq_.size())
+    std::condition_variable cv_sender_;  // Notifies senders when space is available.
+    std::atomic<bool> high_water_armed_{false};         // Cleared when the hook fires, set again at mark / 2
+    std::function<void(std::size_t)> high_water_hook_;  // Set before the channel is shared
+    std::atomic<std::uint64_t> dropped_{0};              // Values discarded by the overflow policy
+    channel_detail::SendGate send_gate_;                  // Lock-free pushes in flight; close() waits for them
+
+    // Receiver side: the mirror image
+    alignas(channel_detail::cache_line_size) std::atomic<std::size_t> waiting_receivers_{0};  // Receivers parked on cv_receiver_ or recvq_ (unbuffered: recvq_.size())
+    std::condition_variable cv_receiver_;  // Notifies receivers when data is available.
+
+    // The lock and the state only touched while holding it
+    alignas(channel_detail::cache_line_size) mutable std::mutex mtx;
+
+    // Unbuffered channels rendezvous through these queues alone; buffered ones only park async records here
+    channel_detail::WaitQueue<RecvWaiter> recvq_;  // Parked receives
+    channel_detail::WaitQueue<SendWaiter> sendq_;  // Parked sends
+
+    channel_detail::WaitQueue<channel_detail::SelectWaiter> recv_watchers_;  // Suspended selects' receive cases
+    channel_detail::WaitQueue<channel_detail::SelectWaiter> send_watchers_;  // Suspended selects' send cases
+
+    // Slow-path statistics, kept off the lines above
+    alignas(channel_detail::cache_line_size) std::atomic<std::uint64_t> spin_successes_{0};  // Blocking waits resolved while spinning
+    std::atomic<std::uint64_t> spin_failures_{0};  // Blocking waits that spun and then parked
+#if CHANNEL_ENABLE_METRICS
+    channel_detail::MetricsRecorder metrics_;
+#endif
+
+    // Whether a receive/send could proceed right now; caller holds mtx
+    bool receive_ready_locked() const;
+    bool send_ready_locked() const;
+
+    /**
+     * @brief Fires every parked select case whose operation could now proceed. Caller holds mtx.
+     * @param everything Fire every parked case regardless of readiness (used by close()).
+     */
+    void fire_watchers_locked(bool everything = false);
+
+    // Metrics hooks; empty, and optimised away, unless CHANNEL_ENABLE_METRICS is set
+    void count_sent(std::size_t n = 1);
+    void count_received(std::size_t n = 1);
+    void count_handoff();  // An unbuffered value passed straight from a sender to a receiver
+    void count_try_failure(bool sending);
+    void count_wait(bool sending, const channel_detail::WaitTimer &timer);
+
+    /**
+     * @brief Wakes up to `n` parked receivers (and select waiters) after items were pushed without the lock.
+     */
+    void wake_receiver(std::size_t n = 1);
+
+    /**
+     * @brief Runs the high-water hook if this send took the depth to the mark. Called without mtx.
+     */
+    void check_high_water();
+
+    // Auto-tuning hooks around buffered slow-path waits; no-ops unless tuner_ is set. Called without mtx.
+    std::chrono::steady_clock::time_point tuning_clock() const;  // now(), only when tuning
+    void tune_after_send_wait(std::chrono::steady_clock::time_point blocked_since);
+    void tune_after_receive_wait();
+
+    /**
+     * @brief Wakes up to `n` parked senders (and select waiters) after items were popped without the lock.
+     */
+    void wake_sender(std::size_t n = 1);
 };
 
 #include "channel.tpp"
\ No newline at end of file
@@ -2,190 +2,1438 @@
 
 // Constructor
 template <typename T>
-Channel<T>::Channel(std::size_t buffer_size) : buffer_size_(buffer_size), has_data_(false), closed_(false) {}
+Channel<T>::Channel(std::size_t buffer_size, WaitStrategy wait_strategy, std::pmr::memory_resource *resource)
+    : buffer_size_(buffer_size),
+      wait_strategy_(wait_strategy),
+      resource_(resource),
+      buffer_(buffer_size,
+              buffer_size == unbounded ? channel_detail::ChannelBuffer<T>::Kind::Unbounded
+                                       : channel_detail::ChannelBuffer<T>::Kind::Ring,
+              resource) {}
+
+// Lossy constructor - The buffer is a plain ring; the policy only changes what a full ring does to a sender
+template <typename T>
+Channel<T>::Channel(std::size_t buffer_size, OverflowPolicy overflow, WaitStrategy wait_strategy,
+                    std::pmr::memory_resource *resource)
+    : Channel(buffer_size, wait_strategy, resource) {
+    if (buffer_size == 0) {
+        throw std::invalid_argument("An overflow policy needs a buffered channel");
+    }
+    if (overflow == OverflowPolicy::KeepLatest && buffer_size != 1) {
+        throw std::invalid_argument("OverflowPolicy::KeepLatest needs a buffer size of 1");
+    }
+    overflow_ = overflow;
+}
+
+// Resizable constructor - buffer_size_ only records that the channel is buffered; buffer_ owns the capacity
+template <typename T>
+Channel<T>::Channel(ResizableCapacity capacity, WaitStrategy wait_strategy, std::pmr::memory_resource *resource)
+    : buffer_size_(capacity.initial),
+      wait_strategy_(wait_strategy),
+      resource_(resource),
+      buffer_(capacity.initial, channel_detail::ChannelBuffer<T>::Kind::Resizable, resource) {
+    if (capacity.initial == 0) {
+        throw std::invalid_argument("Resizable channel capacity must be greater than 0");
+    }
+    if (capacity.tuning) tuner_ = channel_detail::new_record<channel_detail::CapacityTuner>(resource_, *capacity.tuning);
+}
+
+// Destructor - Fail whatever async operations are still parked instead of leaving them hanging
+template <typename T>
+Channel<T>::~Channel() {
+    close();
+    if (tuner_) channel_detail::delete_record(resource_, tuner_);
+}
+
+// Set Capacity - The new limit applies to the next push; senders parked for room are woken when it grows
+template <typename T>
+void Channel<T>::set_capacity(std::size_t capacity) {
+    if (!buffer_.resizable()) {
+        throw std::logic_error("set_capacity() needs a channel constructed from ResizableCapacity");
+    }
+    if (capacity == 0) {
+        throw std::invalid_argument("Resizable channel capacity must be greater than 0");
+    }
+
+    std::size_t previous = buffer_.set_capacity(capacity);
+    if (capacity > previous) wake_sender(capacity - previous);
+}
+
+// Overflow push - Evict from the head until the value fits; a receiver may empty the slot first, which is just as good
+template <typename T>
+template <typename... Args>
+bool Channel<T>::push_overflowing(Args &&...args) {
+    if (!evicts()) return false;  // DropNewest
+
+    while (!buffer_.try_emplace(std::forward<Args>(args)...)) {
+        if (buffer_.try_pop()) dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+// Tuning hooks - Only resizable channels with a CapacityTuning pay for the clock reads
+template <typename T>
+std::chrono::steady_clock::time_point Channel<T>::tuning_clock() const {
+    return tuner_ ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+}
+
+template <typename T>
+void Channel<T>::tune_after_send_wait(std::chrono::steady_clock::time_point blocked_since) {
+    if (!tuner_) return;
+    auto blocked = std::chrono::steady_clock::now() - blocked_since;
+    if (auto capacity = tuner_->sender_blocked(blocked, buffer_.capacity())) set_capacity(*capacity);
+}
+
+template <typename T>
+void Channel<T>::tune_after_receive_wait() {
+    if (!tuner_) return;
+    if (auto capacity = tuner_->receiver_waited(buffer_.capacity())) set_capacity(*capacity);
+}
+
+// Wake parked receivers - Only takes the lock when someone is actually parked
+template <typename T>
+void Channel<T>::wake_receiver(std::size_t n) {
+    if (high_water_mark_ != 0) check_high_water();
+
+    // Pairs with the fence in the receiver's slow path: either it sees our item or we see it parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_receivers_.load(std::memory_order_relaxed) == 0 &&
+        watcher_count_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    RecvWaiter *done_receivers = nullptr;
+    SendWaiter *done_senders = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        settle_locked(done_receivers, done_senders);
+        if (n >= waiting_receivers_.load(std::memory_order_relaxed)) {
+            cv_receiver_.notify_all();
+        } else {
+            for (std::size_t i = 0; i < n; i++) cv_receiver_.notify_one();
+        }
+        fire_watchers_locked();
+    }
+    complete_all(done_receivers);
+    complete_all(done_senders);
+}
+
+// High-water check - Edge-triggered, so a channel sitting above the mark does not call back on every send
+template <typename T>
+void Channel<T>::check_high_water() {
+    std::size_t depth = buffer_.size();
+    if (depth >= high_water_mark_) {
+        if (high_water_armed_.load(std::memory_order_relaxed) &&
+            high_water_armed_.exchange(false, std::memory_order_relaxed)) {
+            high_water_hook_(depth);
+        }
+    } else if (depth <= high_water_mark_ / 2 && !high_water_armed_.load(std::memory_order_relaxed)) {
+        high_water_armed_.store(true, std::memory_order_relaxed);
+    }
+}
+
+// Wake parked senders - Only takes the lock when someone is actually parked
+template <typename T>
+void Channel<T>::wake_sender(std::size_t n) {
+    // Pairs with the fence in the sender's slow path: either it sees the free slot or we see it parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_senders_.load(std::memory_order_relaxed) == 0 &&
+        watcher_count_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    RecvWaiter *done_receivers = nullptr;
+    SendWaiter *done_senders = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        settle_locked(done_receivers, done_senders);
+        if (n >= waiting_senders_.load(std::memory_order_relaxed)) {
+            cv_sender_.notify_all();
+        } else {
+            for (std::size_t i = 0; i < n; i++) cv_sender_.notify_one();
+        }
+        fire_watchers_locked();
+    }
+    complete_all(done_receivers);
+    complete_all(done_senders);
+}
+
+// Spin phase of a blocking wait - Nothing to do (or count) for WaitStrategy::block()
+template <typename T>
+template <typename Ready>
+bool Channel<T>::spin_wait(Ready &&ready) {
+    return spin_wait(ready, []() { return false; });
+}
+
+template <typename T>
+template <typename Ready, typename Expired>
+bool Channel<T>::spin_wait(Ready &&ready, Expired &&expired) {
+    if (wait_strategy_.kind == WaitStrategy::Kind::Block) return false;
+    bool ok = false;
+    channel_detail::spin_until(wait_strategy_, [&]() { return (ok = ready()) || expired(); });
+    (ok ? spin_successes_ : spin_failures_).fetch_add(1, std::memory_order_relaxed);
+    return ok;
+}
+
+// Metrics hooks - Compiled to nothing unless CHANNEL_ENABLE_METRICS is set
+template <typename T>
+void Channel<T>::count_sent(std::size_t n) {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.sent(n, buffer_.size());
+#endif
+}
+
+template <typename T>
+void Channel<T>::count_received(std::size_t n) {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.received(n);
+#endif
+}
+
+template <typename T>
+void Channel<T>::count_handoff() {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.sent(1, 0);
+    metrics_.received(1);
+#endif
+}
+
+template <typename T>
+void Channel<T>::count_try_failure(bool sending) {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.try_failed(sending);
+#endif
+}
+
+template <typename T>
+void Channel<T>::count_wait(bool sending, const channel_detail::WaitTimer &timer) {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.waited(sending, timer.elapsed_ns());
+#endif
+}
+
+template <typename T>
+void Channel<T>::select_wakeup_used() {
+#if CHANNEL_ENABLE_METRICS
+    metrics_.select_used();
+#endif
+}
+
+// Pair parked async waiters with the ring - Runs under mtx on the wake paths and in close()
+template <typename T>
+void Channel<T>::settle_locked(RecvWaiter *&done_receivers, SendWaiter *&done_senders) {
+    if (buffer_size_ == 0) return;
+
+    bool progress = true;
+    while (progress) {
+        progress = false;
+
+        // Hand buffered items to parked receivers
+        while (!recvq_.empty()) {
+            auto value = buffer_.try_pop();
+            if (!value) break;
+            RecvWaiter *w = recvq_.pop_front();
+            waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+            w->value = std::move(value);
+            w->next = done_receivers;
+            done_receivers = w;
+            count_received();
+            cv_sender_.notify_one();  // A slot was freed
+            progress = true;
+        }
+
+        // Move parked senders' values into free slots
+        while (!sendq_.empty()) {
+            SendWaiter *w = sendq_.front();
+            if (!buffer_.try_push(std::move(*w->value))) break;  // Only moved from on success
+            sendq_.pop_front();
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+            w->sent = true;
+            w->next = done_senders;
+            done_senders = w;
+            count_sent();
+            cv_receiver_.notify_one();  // An item was published
+            progress = true;
+        }
+    }
+}
 
 // Send a value to the channel - Handles both buffered and unbuffered channels - Blocking Send
 template <typename T>
 void Channel<T>::send(const T &value) {
+    send_impl(value);
+}
+
+template <typename T>
+void Channel<T>::send(T &&value) {
+    send_impl(std::move(value));
+}
+
+// Construct a value in place and send it - Blocking Send
+template <typename T>
+template <typename... Args>
+void Channel<T>::emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...> && std::is_nothrow_move_constructible_v<T>) {
+        // The buffer builds such a value before claiming a slot on every attempt; build it once instead
+        if (buffer_size_ > 0) return send_impl(T(std::forward<Args>(args)...));
+    }
+    send_impl(std::forward<Args>(args)...);
+}
+
+// Shared blocking send - args are only consumed by the attempt that succeeds
+template <typename T>
+template <typename... Args>
+void Channel<T>::send_impl(Args &&...args) {
+    if (buffer_size_ > 0) {
+        // Go with buffered channel logic
+
+        // Fast path: free slot in the ring, no lock needed. A lossy channel's overflow policy makes
+        // room or drops the value instead, but never waits
+        bool pushed = false;
+        if (!send_gate_.admit([&]() {
+                pushed = buffer_.try_emplace(std::forward<Args>(args)...) ||
+                         (overflow_ != OverflowPolicy::Block && push_overflowing(std::forward<Args>(args)...));
+            })) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+        if (pushed) {
+            count_sent();
+            wake_receiver();
+            return;
+        }
+        if (overflow_ != OverflowPolicy::Block) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Slow path: spin if the strategy allows, then park until a receiver frees a slot or the channel closes
+        channel_detail::WaitTimer timer;
+        auto blocked_since = tuning_clock();
+        auto attempt = [&]() {
+            return !send_gate_.admit([&]() { pushed = buffer_.try_emplace(std::forward<Args>(args)...); }) || pushed;
+        };
+        if (!spin_wait(attempt)) {
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_sender_.wait(lock, attempt);
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        count_wait(true, timer);
+        tune_after_send_wait(blocked_since);
+
+        if (!pushed) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+
+        count_sent();
+        wake_receiver();
+        return;
+    }
+
+    // Go with unbuffered channel logic
     std::unique_lock<std::mutex> lock(mtx);
 
     if (closed_) {
         throw std::runtime_error("Cannot send to a closed channel");
     }
 
-    if (buffer_size_ == 0) {
-        // Go with unbuffered channel logic
-
-        // Wait if there's already data waiting to be received
-        cv_sender_.wait(lock, [this]() { return !has_data_ || closed_; });
+    // A parked receiver takes the value directly
+    if (RecvWaiter *w = recvq_.pop_front()) {
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        w->value.emplace(std::forward<Args>(args)...);
+        count_handoff();
+        lock.unlock();
+        w->complete(w);
+        return;
+    }
 
-        data_ = value;
-        has_data_ = true;
+    // Otherwise park with the value until a receiver takes it (or close() fails us)
+    channel_detail::WaitTimer timer;
+    Parked<SendWaiter> self;
+    self.value.emplace(std::forward<Args>(args)...);
+    sendq_.push_back(&self);
+    waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+    fire_watchers_locked();
+    lock.unlock();
 
-        cv_receiver_.notify_one();  // Notify a waiting receiver
-        notify_all_registered();
+    self.wait(*this);
+    count_wait(true, timer);
+    if (!self.sent) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+}
 
-        // Wait until receiver consumes it
-        cv_sender_.wait(lock, [this]() { return !has_data_ || closed_; });
-    } else {
+// Receive a value from the channel - Handles both buffered and unbuffered channels - Blocking Receive
+template <typename T>
+std::optional<T> Channel<T>::receive() {
+    if (buffer_size_ > 0) {
         // Go with buffered channel logic
-        cv_sender_.wait(lock, [this]() { return buffer_.size() < buffer_size_ || closed_; });
 
-        if (closed_) {
-            throw std::runtime_error("Cannot send to a closed channel");
+        // Fast path: take the head of the ring without locking
+        if (auto value = buffer_.try_pop()) {
+            count_received();
+            wake_sender();
+            return value;
+        }
+
+        // Slow path: spin if the strategy allows, then park until a sender publishes an item or the channel closes
+        channel_detail::WaitTimer timer;
+        std::optional<T> value;
+        auto attempt = [&]() {
+            bool closed = closed_.load(std::memory_order_acquire);  // Before popping: a close seen here follows every send
+            value = buffer_.try_pop();
+            return value.has_value() || closed;
+        };
+        if (!spin_wait(attempt)) {
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_receiver_.wait(lock, attempt);
+            waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
         }
+        count_wait(false, timer);
+        tune_after_receive_wait();
 
-        buffer_.push(value);
+        if (!value) {
+            return std::nullopt;  // Closed and drained
+        }
+
+        count_received();
+        wake_sender();
+        return value;
+    }
+
+    // Go with unbuffered channel logic
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Take the value straight out of a parked sender
+    if (SendWaiter *w = sendq_.pop_front()) {
+        waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        std::optional<T> value = std::move(w->value);
+        w->sent = true;
+        count_handoff();
+        lock.unlock();
+        w->complete(w);
+        return value;
+    }
 
-        // Notify a waiting receiver that there's new data
-        cv_receiver_.notify_one();
-        notify_all_registered();
+    if (closed_) {
+        return std::nullopt;
     }
+
+    // Otherwise park until a sender moves its value into our record (or close() leaves it empty)
+    channel_detail::WaitTimer timer;
+    Parked<RecvWaiter> self;
+    recvq_.push_back(&self);
+    waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+    fire_watchers_locked();  // A select's send case can now hand its value over
+    lock.unlock();
+
+    self.wait(*this);
+    count_wait(false, timer);
+    return std::move(self.value);
 }
 
-// Receive a value from the channel - Handles both buffered and unbuffered channels - Blocking Receive
+// Timed Send - The deadline is only computed once the fast path has failed
 template <typename T>
-std::optional<T> Channel<T>::receive() {
+template <typename Rep, typename Period>
+bool Channel<T>::send_for(const T &value, const std::chrono::duration<Rep, Period> &timeout) {
+    return send_timed(value, [&timeout]() { return channel_detail::deadline_after(timeout); });
+}
+
+template <typename T>
+template <typename Rep, typename Period>
+bool Channel<T>::send_for(T &&value, const std::chrono::duration<Rep, Period> &timeout) {
+    return send_timed(std::move(value), [&timeout]() { return channel_detail::deadline_after(timeout); });
+}
+
+template <typename T>
+template <typename Clock, typename Duration>
+bool Channel<T>::send_until(const T &value, const std::chrono::time_point<Clock, Duration> &deadline) {
+    return send_timed(value, [&deadline]() { return std::optional(deadline); });
+}
+
+template <typename T>
+template <typename Clock, typename Duration>
+bool Channel<T>::send_until(T &&value, const std::chrono::time_point<Clock, Duration> &deadline) {
+    return send_timed(std::move(value), [&deadline]() { return std::optional(deadline); });
+}
+
+// Shared timed send - Same paths as send_impl(), but the wait ends at the deadline and a parked
+// unbuffered offer is withdrawn again if no receiver took it
+template <typename T>
+template <typename U, typename DeadlineOf>
+bool Channel<T>::send_timed(U &&value, DeadlineOf &&deadline_of) {
+    if (buffer_size_ > 0) {
+        // Fast path: free slot in the ring (or room the overflow policy made), exactly like send()
+        bool pushed = false;
+        if (!send_gate_.admit([&]() {
+                pushed = buffer_.try_emplace(std::forward<U>(value)) ||
+                         (overflow_ != OverflowPolicy::Block && push_overflowing(std::forward<U>(value)));
+            })) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+        if (pushed) {
+            count_sent();
+            wake_receiver();
+            return true;
+        }
+
+        // Lossy channel: nothing to wait for; DropNewest reports the full buffer like try_send()
+        if (overflow_ != OverflowPolicy::Block) return false;
+
+        auto deadline = deadline_of();
+        if (!deadline) {  // Too far away to matter
+            send_impl(std::forward<U>(value));
+            return true;
+        }
+        using Deadline = std::decay_t<decltype(*deadline)>;
+
+        // Slow path: spin if the strategy allows, then park until a slot frees up, the channel closes or time runs out
+        channel_detail::WaitTimer timer;
+        auto blocked_since = tuning_clock();
+        auto attempt = [&]() {
+            return !send_gate_.admit([&]() { pushed = buffer_.try_emplace(std::forward<U>(value)); }) || pushed;
+        };
+        if (!spin_wait(attempt, channel_detail::DeadlinePoll<typename Deadline::clock, typename Deadline::duration>(*deadline))) {
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_sender_.wait_until(lock, *deadline, attempt);
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        count_wait(true, timer);
+        tune_after_send_wait(blocked_since);
+
+        if (!pushed) {
+            if (send_gate_.is_closing()) {
+                throw std::runtime_error("Cannot send to a closed channel");
+            }
+            return false;  // Timed out
+        }
+
+        count_sent();
+        wake_receiver();
+        return true;
+    }
+
     std::unique_lock<std::mutex> lock(mtx);
 
-    if (buffer_size_ == 0) {
-        // Go with unbuffered channel logic
+    if (closed_) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
 
-        waiting_receivers_++;
-        // Wait until sender sends data
-        cv_receiver_.wait(lock, [this]() { return has_data_ || closed_; });
-        waiting_receivers_--;
+    // A parked receiver takes the value directly
+    if (RecvWaiter *w = recvq_.pop_front()) {
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        w->value.emplace(std::forward<U>(value));
+        count_handoff();
+        lock.unlock();
+        w->complete(w);
+        return true;
+    }
 
-        if (!has_data_ && closed_) {
-            return std::nullopt;
+    auto deadline = deadline_of();
+    if (!deadline) {
+        lock.unlock();
+        send_impl(std::forward<U>(value));
+        return true;
+    }
+
+    // Otherwise offer the value until the deadline
+    channel_detail::WaitTimer timer;
+    Parked<SendWaiter> self;
+    self.value.emplace(std::forward<U>(value));
+    sendq_.push_back(&self);
+    waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+    fire_watchers_locked();
+    lock.unlock();
+
+    if (!self.wait_until(*this, *deadline)) {
+        lock.lock();
+        if (sendq_.contains(&self)) {
+            // Nobody took it: withdraw the offer and hand the value back to an rvalue caller
+            sendq_.remove(&self);
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+            count_wait(true, timer);
+            if constexpr (!std::is_const_v<std::remove_reference_t<U>>) value = std::move(*self.value);
+            return false;
         }
+        lock.unlock();
+        self.parker->park(self.done);  // A receiver (or close) already claimed the record and is about to unpark us
+    }
+    count_wait(true, timer);
 
-        T value = *data_;
-        data_.reset();  // Clear the data after receiving
-        has_data_ = false;
+    if (!self.sent) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+    return true;
+}
 
-        // Notify sender that data has been consumed
-        cv_sender_.notify_one();
-        notify_all_registered();
+// Timed Receive - A ready value costs exactly what receive() costs
+template <typename T>
+template <typename Rep, typename Period>
+std::optional<T> Channel<T>::receive_for(const std::chrono::duration<Rep, Period> &timeout) {
+    return receive_timed([&timeout]() { return channel_detail::deadline_after(timeout); });
+}
 
-        return value;
-    } else {
-        // Go with buffered channel logic
+template <typename T>
+template <typename Clock, typename Duration>
+std::optional<T> Channel<T>::receive_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    return receive_timed([&deadline]() { return std::optional(deadline); });
+}
 
-        // Wait until there's data in the buffer
-        cv_receiver_.wait(lock, [this]() { return !buffer_.empty() || closed_; });
+// Shared timed receive - Mirrors receive(); a parked unbuffered receiver leaves recvq_ again on timeout
+template <typename T>
+template <typename DeadlineOf>
+std::optional<T> Channel<T>::receive_timed(DeadlineOf &&deadline_of) {
+    if (buffer_size_ > 0) {
+        // Fast path: take the head of the ring without locking
+        if (auto value = buffer_.try_pop()) {
+            count_received();
+            wake_sender();
+            return value;
+        }
 
-        if (buffer_.empty() && closed_) {
-            return std::nullopt;
+        auto deadline = deadline_of();
+        if (!deadline) return receive();  // Too far away to matter
+        using Deadline = std::decay_t<decltype(*deadline)>;
+
+        // Slow path: spin if the strategy allows, then park until an item arrives, the channel closes or time runs out
+        channel_detail::WaitTimer timer;
+        std::optional<T> value;
+        auto attempt = [&]() {
+            bool closed = closed_.load(std::memory_order_acquire);  // Before popping: a close seen here follows every send
+            value = buffer_.try_pop();
+            return value.has_value() || closed;
+        };
+        if (!spin_wait(attempt, channel_detail::DeadlinePoll<typename Deadline::clock, typename Deadline::duration>(*deadline))) {
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_receiver_.wait_until(lock, *deadline, attempt);
+            waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
         }
+        count_wait(false, timer);
+        tune_after_receive_wait();
 
-        T value = buffer_.front();
-        buffer_.pop();
+        if (!value) {
+            return std::nullopt;  // Timed out, or closed and drained
+        }
 
-        // Notify sender that there's space in the buffer
-        cv_sender_.notify_one();
-        notify_all_registered();
+        count_received();
+        wake_sender();
         return value;
     }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Take the value straight out of a parked sender
+    if (SendWaiter *w = sendq_.pop_front()) {
+        waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        std::optional<T> value = std::move(w->value);
+        w->sent = true;
+        count_handoff();
+        lock.unlock();
+        w->complete(w);
+        return value;
+    }
+
+    if (closed_) {
+        return std::nullopt;
+    }
+
+    auto deadline = deadline_of();
+    if (!deadline) {
+        lock.unlock();
+        return receive();
+    }
+
+    // Otherwise park until a sender fills our record, close() empties it, or the deadline passes
+    channel_detail::WaitTimer timer;
+    Parked<RecvWaiter> self;
+    recvq_.push_back(&self);
+    waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+    fire_watchers_locked();  // A select's send case can now hand its value over
+    lock.unlock();
+
+    if (!self.wait_until(*this, *deadline)) {
+        lock.lock();
+        if (recvq_.contains(&self)) {
+            recvq_.remove(&self);
+            waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+            count_wait(false, timer);
+            return std::nullopt;
+        }
+        lock.unlock();
+        self.parker->park(self.done);  // A sender (or close) already claimed the record and is about to unpark us
+    }
+    count_wait(false, timer);
+    return std::move(self.value);
 }
 
 // Close the channel
 template <typename T>
 void Channel<T>::close() {
+    // Refuse lock-free pushes and let the ones already under way land before receivers can see the close
+    send_gate_.close();
+
     std::unique_lock<std::mutex> lock(mtx);
-    if (closed_)
+    if (closed_.load(std::memory_order_relaxed))
         return;  // Already closed
 
-    closed_ = true;
+    // Parked async receivers get whatever is still buffered, then nullopt; parked async senders fail
+    RecvWaiter *done_receivers = nullptr;
+    SendWaiter *done_senders = nullptr;
+    settle_locked(done_receivers, done_senders);
+    closed_.store(true, std::memory_order_release);
+    while (RecvWaiter *w = recvq_.pop_front()) {
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        w->next = done_receivers;
+        done_receivers = w;
+    }
+    while (SendWaiter *w = sendq_.pop_front()) {
+        waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        w->next = done_senders;
+        done_senders = w;
+    }
 
     // Notify all waiting threads
     cv_receiver_.notify_all();  // Notify all receivers that channel is closed
     cv_sender_.notify_all();    // Notify all senders that channel is closed
-    notify_all_registered();
+    fire_watchers_locked(true);  // Every parked select re-checks its cases
+
+    lock.unlock();
+    complete_all(done_receivers);
+    complete_all(done_senders);
 }
 
 // Check closed state
 template <typename T>
 bool Channel<T>::is_closed() const {
-    std::unique_lock<std::mutex> lock(mtx);
-    return closed_;
+    return closed_.load(std::memory_order_acquire);
 }
 
 // Check emptiness
 template <typename T>
 bool Channel<T>::empty() const {
-    std::lock_guard<std::mutex> lock(mtx);
     if (buffer_size_ == 0) {
-        return !has_data_;  // unbuffered behaviour
+        return waiting_senders_.load(std::memory_order_acquire) == 0;  // unbuffered behaviour: no sender is parked
     } else {
         return buffer_.empty();  // buffered behaviour
     }
 }
 
+// Buffered item count - Read from the ring's counters, never the lock; clamped since they are read one at a time
+template <typename T>
+std::size_t Channel<T>::len() const {
+    return buffer_size_ == 0 ? 0 : buffer_.size();
+}
+
+// Lock-free readiness probes - Unbuffered channels read the parked counts, which mirror the queue
+// sizes; the answer is a hint that try_receive()/try_send() confirm under the lock
+template <typename T>
+bool Channel<T>::is_receive_ready() const {
+    if (buffer_size_ == 0) return waiting_senders_.load(std::memory_order_acquire) > 0;
+    return !buffer_.empty();
+}
+
+template <typename T>
+bool Channel<T>::is_send_ready() const {
+    if (send_gate_.is_closing()) return false;
+    if (buffer_size_ == 0) return waiting_receivers_.load(std::memory_order_acquire) > 0;
+    return evicts() || !buffer_.full();
+}
+
+// Readiness as seen under the lock - Whether try_receive()/try_send() would succeed, like Select::run() checks
+template <typename T>
+bool Channel<T>::receive_ready_locked() const {
+    if (buffer_size_ > 0) return !buffer_.empty();
+    return !sendq_.empty();
+}
+
+template <typename T>
+bool Channel<T>::send_ready_locked() const {
+    if (send_gate_.is_closing()) return false;
+    if (buffer_size_ > 0) return evicts() || !buffer_.full();
+    return !recvq_.empty();
+}
+
+// Park a select case - Registered before the readiness check so a concurrent wake cannot slip between
+template <typename T>
+bool Channel<T>::watch_receive(channel_detail::SelectWaiter *waiter) {
+    std::lock_guard<std::mutex> lock(mtx);
+    recv_watchers_.push_back(waiter);
+    waiter->sending = false;
+    waiter->queued = true;
+    watcher_count_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with the fence in wake_receiver()
+
+    bool ready = receive_ready_locked() || (waiter->fire_on_close && closed_.load(std::memory_order_relaxed));
+    if (!ready) return false;
+    recv_watchers_.remove(waiter);
+    waiter->queued = false;
+    watcher_count_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T>
+bool Channel<T>::watch_send(channel_detail::SelectWaiter *waiter) {
+    std::lock_guard<std::mutex> lock(mtx);
+    send_watchers_.push_back(waiter);
+    waiter->sending = true;
+    waiter->queued = true;
+    watcher_count_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with the fence in wake_sender()
+
+    if (!send_ready_locked()) return false;
+    send_watchers_.remove(waiter);
+    waiter->queued = false;
+    watcher_count_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T>
+void Channel<T>::unwatch(channel_detail::SelectWaiter *waiter) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!waiter->queued) return;  // Already fired
+    (waiter->sending ? send_watchers_ : recv_watchers_).remove(waiter);
+    waiter->queued = false;
+    watcher_count_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// Fire parked select cases - A select whose sync was already claimed elsewhere just loses its waiter
+template <typename T>
+void Channel<T>::fire_watchers_locked(bool everything) {
+    auto fire_all = [this](channel_detail::WaitQueue<channel_detail::SelectWaiter> &queue) {
+        while (channel_detail::SelectWaiter *w = queue.pop_front()) {
+            w->queued = false;
+            watcher_count_.fetch_sub(1, std::memory_order_relaxed);
+            if (w->sync->try_fire(w->index)) {
+#if CHANNEL_ENABLE_METRICS
+                metrics_.select_woken();
+#endif
+                w->sync->wake(w->sync);
+            }
+        }
+    };
+
+    if (!recv_watchers_.empty() && (everything || receive_ready_locked())) fire_all(recv_watchers_);
+    if (!send_watchers_.empty() && (everything || send_ready_locked())) fire_all(send_watchers_);
+}
+
 // Non-blocking Send
 template <typename T>
 bool Channel<T>::try_send(const T &value) {
-    std::unique_lock<std::mutex> lock(mtx);
+    return try_send_impl(value);
+}
 
-    if (closed_) return false;
+template <typename T>
+bool Channel<T>::try_send(T &&value) {
+    return try_send_impl(std::move(value));
+}
 
-    if (buffer_size_ == 0) {
-        // unbuffered behavior, need a receiver to consume the data
-        if (waiting_receivers_ == 0 || has_data_) return false;  // No receivers available
-        data_ = value;
-        has_data_ = true;
-        cv_receiver_.notify_one();  // Notify a waiting receiver
-        notify_all_registered();
-        return true;
+// Shared non-blocking send - args are left untouched when the send fails
+template <typename T>
+template <typename... Args>
+bool Channel<T>::try_send_impl(Args &&...args) {
+    if (poll_send(std::forward<Args>(args)...)) return true;
+    count_try_failure(true);
+    return false;
+}
 
-    } else {
+// Non-blocking send without the try_send failure count, for callers that go on to park
+template <typename T>
+template <typename... Args>
+bool Channel<T>::poll_send(Args &&...args) {
+    if (buffer_size_ > 0) {
         // buffered behavior
-        if (buffer_.size() >= buffer_size_) return false;  // Buffer is full
-        buffer_.push(value);
-        cv_receiver_.notify_one();  // Notify a waiting receiver
-        notify_all_registered();
+        bool pushed = false;
+        send_gate_.admit([&]() {
+            pushed = buffer_.try_emplace(std::forward<Args>(args)...) || push_overflowing(std::forward<Args>(args)...);
+        });
+        if (!pushed) return false;  // Closed, or the buffer is full
+        count_sent();
+        wake_receiver();
         return true;
     }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // unbuffered behavior: succeeds exactly when a receiver is parked, which takes the value directly
+    RecvWaiter *w = closed_ ? nullptr : recvq_.pop_front();
+    if (!w) return false;  // Closed, or no receivers available
+
+    waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+    w->value.emplace(std::forward<Args>(args)...);
+    count_handoff();
+    lock.unlock();
+    w->complete(w);
+    return true;
 }
 
 // Non-blocking Receive
 template <typename T>
 std::optional<T> Channel<T>::try_receive() {
-    std::unique_lock<std::mutex> lock(mtx);
+    auto value = poll_receive();
+    if (!value) count_try_failure(false);
+    return value;
+}
 
-    if (buffer_size_ == 0) {
-        // unbuffered behavior
-        if (!has_data_) return std::nullopt;  // No data available
-
-        T value = *data_;
-        data_.reset();  // Clear the data after receiving
-        has_data_ = false;
-        cv_sender_.notify_one();  // Notify sender that data has been consumed
-        notify_all_registered();
-        return value;
-    } else {
+// Non-blocking receive without the try_receive failure count, for callers that go on to park
+template <typename T>
+std::optional<T> Channel<T>::poll_receive() {
+    if (buffer_size_ > 0) {
         // buffered behavior
-        if (buffer_.empty()) return std::nullopt;  // No data available
-        T value = buffer_.front();
-        buffer_.pop();
-        cv_sender_.notify_one();  // Notify a waiting sender that there's space in the buffer
-        notify_all_registered();
+        auto value = buffer_.try_pop();
+        if (value) {
+            count_received();
+            wake_sender();  // Let a waiting sender know there's space in the buffer
+        }
         return value;
     }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // unbuffered behavior: take the value straight out of a parked sender, if any
+    SendWaiter *w = sendq_.pop_front();
+    if (!w) return std::nullopt;  // No data available
+
+    waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+    std::optional<T> value = std::move(w->value);
+    w->sent = true;
+    count_handoff();
+    lock.unlock();
+    w->complete(w);
+    return value;
+}
+
+// Batch Send - Claims as many ring slots as fit per round and wakes receivers once per round
+template <typename T>
+template <typename ForwardIt>
+void Channel<T>::send_batch(ForwardIt first, ForwardIt last) {
+    if (buffer_size_ == 0) {
+        // Every element of an unbuffered batch still needs its own rendezvous
+        for (; first != last; ++first) send_impl(*first);
+        return;
+    }
+
+    auto remaining = static_cast<std::size_t>(std::distance(first, last));
+    while (remaining > 0) {
+        // Fast path: claim as much of the remaining batch as the ring has room for
+        std::size_t pushed = 0;
+        if (!send_gate_.admit([&]() { pushed = buffer_.try_push_bulk(first, remaining); })) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+        if (pushed > 0) {
+            remaining -= pushed;
+            count_sent(pushed);
+            wake_receiver(pushed);
+            continue;
+        }
+
+        // Lossy channel: one element through the overflow policy, then back to claiming in bulk
+        if (overflow_ != OverflowPolicy::Block) {
+            bool kept = false;
+            if (!send_gate_.admit([&]() { kept = push_overflowing(*first); })) {
+                throw std::runtime_error("Cannot send to a closed channel");
+            }
+            if (kept) {
+                count_sent();
+                wake_receiver();
+            } else {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+            ++first;
+            remaining--;
+            continue;
+        }
+
+        // Slow path: spin if the strategy allows, then park until a receiver frees at least one slot or the channel closes
+        channel_detail::WaitTimer timer;
+        auto blocked_since = tuning_clock();
+        auto attempt = [&]() {
+            return !send_gate_.admit([&]() { pushed = buffer_.try_push_bulk(first, remaining); }) || pushed > 0;
+        };
+        if (!spin_wait(attempt)) {
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            cv_sender_.wait(lock, attempt);
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        count_wait(true, timer);
+        tune_after_send_wait(blocked_since);
+
+        if (pushed == 0) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+
+        remaining -= pushed;
+        count_sent(pushed);
+        wake_receiver(pushed);
+    }
+}
+
+template <typename T>
+template <typename ForwardIt>
+void Channel<T>::send_n(ForwardIt first, std::size_t n) {
+    auto last = first;
+    std::advance(last, n);
+    send_batch(first, last);
+}
+
+// Batch Receive - Waits for the first element, then drains whatever else is buffered in one claim
+template <typename T>
+template <typename OutputIt>
+std::size_t Channel<T>::receive_batch(OutputIt out, std::size_t max) {
+    if (max == 0) return 0;
+
+    if (buffer_size_ == 0) {
+        // Unbuffered: one rendezvous, then pick up any sender that is already waiting
+        auto value = receive();
+        if (!value) return 0;
+        *out = std::move(*value);
+        ++out;
+        return 1 + try_receive_batch(out, max - 1);
+    }
+
+    // Fast path: something is buffered already
+    std::size_t popped = buffer_.try_pop_bulk(out, max);
+    if (popped > 0) {
+        count_received(popped);
+        wake_sender(popped);
+        return popped;
+    }
+
+    // Slow path: spin if the strategy allows, then park until a sender publishes something or the channel closes
+    channel_detail::WaitTimer timer;
+    auto attempt = [&]() {
+        bool closed = closed_.load(std::memory_order_acquire);  // Before popping: a close seen here follows every send
+        popped = buffer_.try_pop_bulk(out, max);
+        return popped > 0 || closed;
+    };
+    if (!spin_wait(attempt)) {
+        std::unique_lock<std::mutex> lock(mtx);
+        waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        cv_receiver_.wait(lock, attempt);
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    count_wait(false, timer);
+    tune_after_receive_wait();
+
+    if (popped == 0) {
+        return 0;  // Closed and drained
+    }
+
+    count_received(popped);
+    wake_sender(popped);
+    return popped;
+}
+
+// Non-blocking Batch Receive
+template <typename T>
+template <typename OutputIt>
+std::size_t Channel<T>::try_receive_batch(OutputIt out, std::size_t max) {
+    if (buffer_size_ == 0) {
+        std::size_t received = 0;
+        while (received < max) {
+            auto value = try_receive();
+            if (!value) break;
+            *out = std::move(*value);
+            ++out;
+            received++;
+        }
+        return received;
+    }
+
+    std::size_t popped = buffer_.try_pop_bulk(out, max);
+    if (popped > 0) {
+        count_received(popped);
+        wake_sender(popped);
+    }
+    return popped;
+}
+
+// Range Iterator - Walks a consumer-local chunk and refills it with one receive_batch() when it runs out
+template <typename T>
+class Channel<T>::Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    // The end iterator
+    Iterator() = default;
+
+    explicit Iterator(Channel &chan) : chan_(&chan), chunk_(chan.resource_) {
+        chunk_.reserve(iteration_chunk);
+        refill();
+    }
+
+    T &operator*() { return chunk_[pos_]; }
+    const T &operator*() const { return chunk_[pos_]; }
+    T *operator->() { return &chunk_[pos_]; }
+    const T *operator->() const { return &chunk_[pos_]; }
+
+    Iterator &operator++() {
+        if (++pos_ == chunk_.size()) refill();
+        return *this;
+    }
+
+    // Single pass: the item just stepped over is not kept anywhere
+    void operator++(int) { ++*this; }
+
+    // Only meaningful against end(): an iterator equals it once the channel is closed and drained
+    bool operator==(const Iterator &other) const { return chan_ == other.chan_; }
+    bool operator!=(const Iterator &other) const { return chan_ != other.chan_; }
+
+   private:
+    void refill() {
+        chunk_.clear();
+        pos_ = 0;
+        if (chan_->receive_batch(std::back_inserter(chunk_), iteration_chunk) == 0) {
+            chan_ = nullptr;  // Closed and drained
+        }
+    }
+
+    Channel *chan_ = nullptr;
+    std::pmr::vector<T> chunk_;
+    std::size_t pos_ = 0;
+};
+
+template <typename T>
+typename Channel<T>::Iterator Channel<T>::begin() {
+    return Iterator(*this);
+}
+
+template <typename T>
+typename Channel<T>::Iterator Channel<T>::end() {
+    return Iterator();
+}
+
+// Park or complete an async receive - Returns true if the record was completed right away
+template <typename T>
+bool Channel<T>::submit_receive(RecvWaiter *waiter) {
+    if (buffer_size_ > 0) {
+        // Fast path: something is buffered already
+        if (auto value = buffer_.try_pop()) {
+            waiter->value = std::move(value);
+            count_received();
+            wake_sender();
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Re-check now that senders can see us; otherwise park for a sender (or close) to complete us
+        waiter->value = buffer_.try_pop();
+        if (!waiter->value && !closed_.load(std::memory_order_relaxed)) {
+            recvq_.push_back(waiter);
+            return false;
+        }
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        lock.unlock();
+
+        if (waiter->value) {
+            count_received();
+            wake_sender();
+        }
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    if (SendWaiter *sender = sendq_.pop_front()) {
+        // Pair directly with a parked sender
+        waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+        waiter->value = std::move(sender->value);
+        sender->sent = true;
+        count_handoff();
+        lock.unlock();
+        sender->complete(sender);
+    } else if (!closed_) {
+        recvq_.push_back(waiter);
+        waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+        fire_watchers_locked();
+        return false;
+    }
+    return true;
+}
+
+// Park or complete an async send - Returns true if the record was completed right away
+template <typename T>
+bool Channel<T>::submit_send(SendWaiter *waiter) {
+    if (buffer_size_ > 0) {
+        // Fast path: room in the ring, or room a lossy channel's overflow policy made
+        bool pushed = false;
+        bool open = send_gate_.admit([&]() {
+            pushed = buffer_.try_push(std::move(*waiter->value)) ||
+                     (overflow_ != OverflowPolicy::Block && push_overflowing(std::move(*waiter->value)));
+        });
+        if (open) {
+            if (pushed) {
+                waiter->sent = true;
+                count_sent();
+                wake_receiver();
+                return true;
+            }
+
+            // Lossy channel: completes at once; a value DropNewest discards still counts as sent
+            if (overflow_ != OverflowPolicy::Block) {
+                waiter->sent = true;
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            std::unique_lock<std::mutex> lock(mtx);
+            waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Re-check now that receivers can see us; otherwise park for a receiver (or close) to complete us
+            if (!closed_.load(std::memory_order_relaxed)) {
+                waiter->sent = buffer_.try_push(std::move(*waiter->value));
+                if (!waiter->sent) {
+                    sendq_.push_back(waiter);
+                    return false;
+                }
+            }
+            waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+            lock.unlock();
+
+            if (waiter->sent) {
+                count_sent();
+                wake_receiver();
+            }
+        }
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    if (closed_) return true;
+
+    if (RecvWaiter *receiver = recvq_.pop_front()) {
+        // Pair directly with a parked receiver
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        receiver->value = std::move(waiter->value);
+        waiter->sent = true;
+        count_handoff();
+        lock.unlock();
+        receiver->complete(receiver);
+        return true;
+    }
+
+    sendq_.push_back(waiter);
+    waiting_senders_.fetch_add(1, std::memory_order_relaxed);
+    fire_watchers_locked();
+    return false;
 }
 
-// Asynchronous Send using std::async
+// Asynchronous Send - Parked on the channel until a receiver takes the value
 template <typename T>
 std::future<void> Channel<T>::async_send(const T &value) {
-    return std::async(std::launch::async, [this, value]() {
-        this->send(value);
-    });
+    return async_send(T(value));
+}
+
+template <typename T>
+std::future<void> Channel<T>::async_send(T &&value) {
+    // The record and the future's shared state both come from resource_
+    struct Pending : SendWaiter {
+        std::pmr::memory_resource *resource;
+        std::promise<void> promise;
+
+        explicit Pending(std::pmr::memory_resource *r)
+            : resource(r), promise(std::allocator_arg, std::pmr::polymorphic_allocator<char>(r)) {}
+    };
+
+    auto *pending = channel_detail::new_record<Pending>(resource_, resource_);
+    pending->value.emplace(std::move(value));
+    pending->complete = [](SendWaiter *w) {
+        auto *self = static_cast<Pending *>(w);
+        if (self->sent) {
+            self->promise.set_value();
+        } else {
+            self->promise.set_exception(
+                std::make_exception_ptr(std::runtime_error("Cannot send to a closed channel")));
+        }
+        channel_detail::delete_record(self->resource, self);
+    };
+
+    auto future = pending->promise.get_future();
+    if (submit_send(pending)) pending->complete(pending);
+    return future;
+}
+
+template <typename T>
+template <typename F>
+void Channel<T>::async_send(const T &value, F &&on_complete) {
+    async_send(T(value), std::forward<F>(on_complete));
+}
+
+template <typename T>
+template <typename F>
+void Channel<T>::async_send(T &&value, F &&on_complete) {
+    struct Pending : SendWaiter {
+        std::decay_t<F> callback;
+        Executor *executor;
+        std::pmr::memory_resource *resource;
+
+        Pending(F &&f, Executor *ex, std::pmr::memory_resource *r)
+            : callback(std::forward<F>(f)), executor(ex), resource(r) {}
+    };
+
+    auto *pending = channel_detail::new_record<Pending>(resource_, std::forward<F>(on_complete), &executor(), resource_);
+    pending->value.emplace(std::move(value));
+    pending->complete = [](SendWaiter *w) {
+        auto *self = static_cast<Pending *>(w);
+        self->executor->execute([self]() {
+            self->callback(self->sent);
+            channel_detail::delete_record(self->resource, self);
+        });
+    };
+    if (submit_send(pending)) pending->complete(pending);
 }
 
-// Asynchronous Receive using std::async
+// Asynchronous Receive - Parked on the channel until a sender provides a value
 template <typename T>
 std::future<std::optional<T>> Channel<T>::async_receive() {
-    return std::async(std::launch::async, [this]() {
-        return this->receive();
-    });
+    struct Pending : RecvWaiter {
+        std::pmr::memory_resource *resource;
+        std::promise<std::optional<T>> promise;
+
+        explicit Pending(std::pmr::memory_resource *r)
+            : resource(r), promise(std::allocator_arg, std::pmr::polymorphic_allocator<char>(r)) {}
+    };
+
+    auto *pending = channel_detail::new_record<Pending>(resource_, resource_);
+    pending->complete = [](RecvWaiter *w) {
+        auto *self = static_cast<Pending *>(w);
+        self->promise.set_value(std::move(self->value));
+        channel_detail::delete_record(self->resource, self);
+    };
+
+    auto future = pending->promise.get_future();
+    if (submit_receive(pending)) pending->complete(pending);
+    return future;
+}
+
+template <typename T>
+template <typename F>
+void Channel<T>::async_receive(F &&on_complete) {
+    struct Pending : RecvWaiter {
+        std::decay_t<F> callback;
+        Executor *executor;
+        std::pmr::memory_resource *resource;
+
+        Pending(F &&f, Executor *ex, std::pmr::memory_resource *r)
+            : callback(std::forward<F>(f)), executor(ex), resource(r) {}
+    };
+
+    auto *pending = channel_detail::new_record<Pending>(resource_, std::forward<F>(on_complete), &executor(), resource_);
+    pending->complete = [](RecvWaiter *w) {
+        auto *self = static_cast<Pending *>(w);
+        self->executor->execute([self]() {
+            self->callback(std::move(self->value));
+            channel_detail::delete_record(self->resource, self);
+        });
+    };
+    if (submit_receive(pending)) pending->complete(pending);
+}
+
+#if CHANNEL_HAS_COROUTINES
+
+// Awaitable receive - The awaitable itself is the waiter record, so a suspended receive never allocates
+template <typename T>
+class Channel<T>::ReceiveAwaitable : private Channel<T>::RecvWaiter {
+   public:
+    explicit ReceiveAwaitable(Channel &chan) : chan_(chan) {}
+    ReceiveAwaitable(const ReceiveAwaitable &) = delete;
+    ReceiveAwaitable &operator=(const ReceiveAwaitable &) = delete;
+
+    bool await_ready() {
+        this->value = chan_.poll_receive();  // A miss here parks rather than failing
+        return this->value.has_value();
+    }
+
+    // Returns false (resume now) when the receive completed without parking
+    bool await_suspend(std::coroutine_handle<> handle) {
+        handle_ = handle;
+        scheduler_ = CoroScheduler::current();
+        this->complete = [](RecvWaiter *w) {
+            auto *self = static_cast<ReceiveAwaitable *>(w);
+            channel_detail::resume_on(self->handle_, self->scheduler_);
+        };
+        return !chan_.submit_receive(this);  // Once parked, the record may be resumed before we return
+    }
+
+    std::optional<T> await_resume() { return std::move(this->value); }
+
+   private:
+    Channel &chan_;
+    std::coroutine_handle<> handle_;
+    CoroScheduler *scheduler_ = nullptr;
+};
+
+// Awaitable send
+template <typename T>
+class Channel<T>::SendAwaitable : private Channel<T>::SendWaiter {
+   public:
+    template <typename U>
+    SendAwaitable(Channel &chan, U &&value) : chan_(chan) {
+        this->value.emplace(std::forward<U>(value));
+    }
+    SendAwaitable(const SendAwaitable &) = delete;
+    SendAwaitable &operator=(const SendAwaitable &) = delete;
+
+    bool await_ready() {
+        this->sent = chan_.poll_send(std::move(*this->value));  // Only moved from on success
+        return this->sent;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        handle_ = handle;
+        scheduler_ = CoroScheduler::current();
+        this->complete = [](SendWaiter *w) {
+            auto *self = static_cast<SendAwaitable *>(w);
+            channel_detail::resume_on(self->handle_, self->scheduler_);
+        };
+        return !chan_.submit_send(this);
+    }
+
+    void await_resume() {
+        if (!this->sent) {
+            throw std::runtime_error("Cannot send to a closed channel");
+        }
+    }
+
+   private:
+    Channel &chan_;
+    std::coroutine_handle<> handle_;
+    CoroScheduler *scheduler_ = nullptr;
+};
+
+template <typename T>
+typename Channel<T>::ReceiveAwaitable Channel<T>::receive_awaitable() {
+    return ReceiveAwaitable(*this);
 }
+
+template <typename T>
+typename Channel<T>::SendAwaitable Channel<T>::async_send_awaitable(const T &value) {
+    return SendAwaitable(*this, value);
+}
+
+template <typename T>
+typename Channel<T>::SendAwaitable Channel<T>::async_send_awaitable(T &&value) {
+    return SendAwaitable(*this, std::move(value));
+}
+
+#endif  // CHANNEL_HAS_COROUTINES
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+
+#include "mpmc_ring.hpp"
+#include "segmented_queue.hpp"
+#include "wait_queue.hpp"
+
+/**
+ * @file channel_buffer.hpp
+ * @brief Storage of a buffered Channel<T>: a bounded MpmcRing, or a SegmentedQueue for unbounded and resizable channels.
+ *
+ * @details
+ * All three share one interface, so the channel's lock-free fast paths, the settle logic and
+ * select readiness are written once against ChannelBuffer. Which engine a channel uses is fixed
+ * at construction, so the dispatch is one well-predicted branch per call.
+ *
+ * A resizable buffer admits pushes through `count_`, a reservation counter checked against the
+ * current limit, so a new limit applies to the very next push. Items already stored above a
+ * lowered limit stay; pushes fail until pops bring the count back under it.
+ */
+
+namespace channel_detail {
+
+template <typename T>
+class ChannelBuffer {
+   public:
+    enum class Kind {
+        Ring,       // Fixed capacity
+        Unbounded,  // Never full
+        Resizable,  // Capacity can change at runtime
+    };
+
+    /**
+     * @param capacity Ring capacity, or the initial limit of a resizable buffer; ignored when unbounded.
+     * @param resource Where the ring or the queue and its blocks are allocated.
+     */
+    ChannelBuffer(std::size_t capacity, Kind kind, std::pmr::memory_resource *resource)
+        : ring_(kind == Kind::Ring ? capacity : 0, resource),
+          segments_(kind == Kind::Ring ? nullptr : new_record<SegmentedQueue<T>>(resource, resource)),
+          resizable_(kind == Kind::Resizable),
+          limit_(capacity),
+          resource_(resource) {}
+
+    ~ChannelBuffer() {
+        if (segments_) delete_record(resource_, segments_);
+    }
+
+    ChannelBuffer(const ChannelBuffer &) = delete;
+    ChannelBuffer &operator=(const ChannelBuffer &) = delete;
+
+    template <typename U>
+    bool try_push(U &&value) {
+        return try_emplace(std::forward<U>(value));
+    }
+
+    template <typename... Args>
+    bool try_emplace(Args &&...args) {
+        if (!segments_) return ring_.try_emplace(std::forward<Args>(args)...);
+        if (!resizable_) return segments_->try_emplace(std::forward<Args>(args)...);
+
+        if (reserve(1) == 0) return false;
+        try {
+            return segments_->try_emplace(std::forward<Args>(args)...);
+        } catch (...) {
+            unreserve(1);  // Nothing was stored
+            throw;
+        }
+    }
+
+    std::optional<T> try_pop() {
+        if (!segments_) return ring_.try_pop();
+        auto value = segments_->try_pop();
+        if (value && resizable_) count_.fetch_sub(1, std::memory_order_release);
+        return value;
+    }
+
+    template <typename InputIt>
+    std::size_t try_push_bulk(InputIt &first, std::size_t n) {
+        if (!segments_) return ring_.try_push_bulk(first, n);
+        if (!resizable_) return segments_->try_push_bulk(first, n);
+
+        std::size_t claimed = reserve(n);
+        std::size_t pushed;
+        try {
+            pushed = segments_->try_push_bulk(first, claimed);
+        } catch (...) {
+            unreserve(claimed);
+            throw;
+        }
+        if (pushed < claimed) unreserve(claimed - pushed);  // A copy threw part-way
+        return pushed;
+    }
+
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt &out, std::size_t n) {
+        if (!segments_) return ring_.try_pop_bulk(out, n);
+        if (!resizable_) return segments_->try_pop_bulk(out, n);
+
+        // Popped here rather than through segments_->try_pop_bulk() so that, if writing to `out`
+        // throws, the reservations of the items already taken (including the lost one) are returned
+        struct Settle {
+            std::atomic<std::size_t> &count;
+            std::size_t taken = 0;
+            ~Settle() {
+                if (taken > 0) count.fetch_sub(taken, std::memory_order_release);
+            }
+        } settle{count_};
+        for (; settle.taken < n; ++out) {
+            auto value = segments_->try_pop();
+            if (!value) break;
+            settle.taken++;
+            *out = std::move(*value);
+        }
+        return settle.taken;
+    }
+
+    bool empty() const { return segments_ ? segments_->empty() : ring_.empty(); }
+
+    bool full() const {
+        if (!segments_) return ring_.full();
+        return resizable_ && count_.load(std::memory_order_acquire) >= limit_.load(std::memory_order_acquire);
+    }
+
+    // Number of stored items; a ring's racy estimate is clamped to its capacity
+    std::size_t size() const {
+        if (!segments_) return std::min(ring_.size(), ring_.capacity());
+        return resizable_ ? count_.load(std::memory_order_acquire) : segments_->size();
+    }
+
+    std::size_t capacity() const {
+        if (!segments_) return ring_.capacity();
+        return resizable_ ? limit_.load(std::memory_order_acquire) : segments_->capacity();
+    }
+
+    bool resizable() const { return resizable_; }
+
+    /**
+     * @brief Changes a resizable buffer's limit.
+     * @return The previous limit.
+     */
+    std::size_t set_capacity(std::size_t limit) { return limit_.exchange(limit, std::memory_order_acq_rel); }
+
+   private:
+    // Claims room for up to `n` pushes under the current limit; returns how many were claimed
+    std::size_t reserve(std::size_t n) {
+        std::size_t count = count_.load(std::memory_order_relaxed);
+        while (true) {
+            std::size_t limit = limit_.load(std::memory_order_acquire);
+            if (count >= limit) return 0;
+            std::size_t claim = std::min(n, limit - count);
+            if (count_.compare_exchange_weak(count, count + claim, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return claim;
+            }
+        }
+    }
+
+    // Gives back room reserve() claimed for pushes that stored nothing
+    void unreserve(std::size_t n) { count_.fetch_sub(n, std::memory_order_release); }
+
+    MpmcRing<T> ring_;             // Empty and never allocated unless the kind is Ring
+    SegmentedQueue<T> *segments_;  // Unbounded and resizable buffers
+    const bool resizable_;
+    std::atomic<std::size_t> limit_;  // Resizable only: current capacity
+    std::pmr::memory_resource *resource_;
+
+    alignas(cache_line_size) std::atomic<std::size_t> count_{0};  // Resizable only: items stored or being stored
+};
+
+}  // namespace channel_detail
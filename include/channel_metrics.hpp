@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "mpmc_ring.hpp"
+
+/**
+ * @file channel_metrics.hpp
+ * @brief Opt-in counters for Channel<T>: traffic, failed try_* calls, blocking waits and select wake-ups.
+ *
+ * @details
+ * Metrics are compiled in only when CHANNEL_ENABLE_METRICS is defined to 1 before the first
+ * channel header is included (or passed with -DCHANNEL_ENABLE_METRICS=1). Otherwise Channel<T>
+ * has no metrics members, every recording call is an empty inline function, and metrics() /
+ * set_metrics_hook() do not exist.
+ *
+ * With metrics on, each channel keeps relaxed atomic counters, split over two cache lines so the
+ * sending and receiving sides do not invalidate each other's line. Channel<T>::metrics() returns
+ * a ChannelMetrics snapshot; the counters are read one by one, so a snapshot taken while the
+ * channel is busy is not a single point in time. Channel<T>::set_metrics_hook() additionally
+ * reports every blocking wait as it ends, for exporting exact latencies.
+ *
+ * Counted:
+ *  - sends/receives: values that entered/left the channel through any operation (blocking,
+ *    try_*, batch, async, coroutine).
+ *  - try_send_failures/try_receive_failures: try_send()/try_receive() calls that returned empty-handed.
+ *  - blocked_sends/blocked_receives and *_wait_ns: blocking operations that could not complete on
+ *    the fast path, and how long they waited (spin phase included). wait_histogram buckets both.
+ *  - high_water_mark: the largest number of buffered items observed after a send.
+ *  - select_wakeups: parked select cases this channel woke; select_useful_wakeups: those whose
+ *    select then went on to run the case on this channel.
+ */
+
+#ifndef CHANNEL_ENABLE_METRICS
+#define CHANNEL_ENABLE_METRICS 0
+#endif
+
+struct ChannelMetrics {
+    // Bucket i counts waits shorter than 2^(i + 9) ns (about 0.5 us << i); the last bucket takes the rest
+    static constexpr std::size_t wait_buckets = 20;
+
+    std::uint64_t sends = 0;
+    std::uint64_t receives = 0;
+    std::uint64_t try_send_failures = 0;
+    std::uint64_t try_receive_failures = 0;
+    std::uint64_t blocked_sends = 0;
+    std::uint64_t blocked_receives = 0;
+    std::uint64_t send_wait_ns = 0;     // Cumulative time blocked senders waited
+    std::uint64_t receive_wait_ns = 0;  // Cumulative time blocked receivers waited
+    std::array<std::uint64_t, wait_buckets> wait_histogram{};
+    std::size_t high_water_mark = 0;
+    std::uint64_t select_wakeups = 0;
+    std::uint64_t select_useful_wakeups = 0;
+
+    // Histogram bucket for a wait of `ns` nanoseconds
+    static std::size_t bucket_for(std::uint64_t ns) {
+        std::size_t bucket = 0;
+        for (ns >>= 9; ns != 0 && bucket + 1 < wait_buckets; ns >>= 1) bucket++;
+        return bucket;
+    }
+};
+
+/**
+ * @brief A blocking wait that just ended, as reported to the metrics hook.
+ */
+struct ChannelWaitEvent {
+    bool sending;           // A blocked send (true) or receive (false)
+    std::uint64_t wait_ns;  // How long it waited
+};
+
+namespace channel_detail {
+
+#if CHANNEL_ENABLE_METRICS
+
+// Start time of a blocking wait
+class WaitTimer {
+   public:
+    std::uint64_t elapsed_ns() const {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+   private:
+    std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+};
+
+// Counters behind Channel<T>::metrics()
+class MetricsRecorder {
+   public:
+    void sent(std::size_t n, std::size_t depth) {
+        send_side_.count.fetch_add(n, std::memory_order_relaxed);
+        std::size_t seen = high_water_mark_.load(std::memory_order_relaxed);
+        while (depth > seen && !high_water_mark_.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    void received(std::size_t n) { receive_side_.count.fetch_add(n, std::memory_order_relaxed); }
+
+    void try_failed(bool sending) {
+        (sending ? send_side_ : receive_side_).try_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void waited(bool sending, std::uint64_t ns) {
+        Side &side = sending ? send_side_ : receive_side_;
+        side.blocked.fetch_add(1, std::memory_order_relaxed);
+        side.wait_ns.fetch_add(ns, std::memory_order_relaxed);
+        wait_histogram_[ChannelMetrics::bucket_for(ns)].fetch_add(1, std::memory_order_relaxed);
+        if (hook_) hook_(ChannelWaitEvent{sending, ns});
+    }
+
+    void select_woken() { select_wakeups_.fetch_add(1, std::memory_order_relaxed); }
+    void select_used() { select_useful_wakeups_.fetch_add(1, std::memory_order_relaxed); }
+
+    void set_hook(std::function<void(const ChannelWaitEvent &)> hook) { hook_ = std::move(hook); }
+
+    ChannelMetrics snapshot() const {
+        ChannelMetrics m;
+        m.sends = send_side_.count.load(std::memory_order_relaxed);
+        m.receives = receive_side_.count.load(std::memory_order_relaxed);
+        m.try_send_failures = send_side_.try_failures.load(std::memory_order_relaxed);
+        m.try_receive_failures = receive_side_.try_failures.load(std::memory_order_relaxed);
+        m.blocked_sends = send_side_.blocked.load(std::memory_order_relaxed);
+        m.blocked_receives = receive_side_.blocked.load(std::memory_order_relaxed);
+        m.send_wait_ns = send_side_.wait_ns.load(std::memory_order_relaxed);
+        m.receive_wait_ns = receive_side_.wait_ns.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < ChannelMetrics::wait_buckets; i++) {
+            m.wait_histogram[i] = wait_histogram_[i].load(std::memory_order_relaxed);
+        }
+        m.high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+        m.select_wakeups = select_wakeups_.load(std::memory_order_relaxed);
+        m.select_useful_wakeups = select_useful_wakeups_.load(std::memory_order_relaxed);
+        return m;
+    }
+
+   private:
+    // Counters written by one side of the channel, kept on their own cache line
+    struct alignas(cache_line_size) Side {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> try_failures{0};
+        std::atomic<std::uint64_t> blocked{0};
+        std::atomic<std::uint64_t> wait_ns{0};
+    };
+
+    Side send_side_;
+    Side receive_side_;
+    alignas(cache_line_size) std::atomic<std::size_t> high_water_mark_{0};
+    std::atomic<std::uint64_t> select_wakeups_{0};
+    std::atomic<std::uint64_t> select_useful_wakeups_{0};
+    std::array<std::atomic<std::uint64_t>, ChannelMetrics::wait_buckets> wait_histogram_{};
+    std::function<void(const ChannelWaitEvent &)> hook_;  // Set before the channel is shared
+};
+
+#else
+
+// Nothing to time with metrics compiled out
+struct WaitTimer {};
+
+#endif
+
+}  // namespace channel_detail
@@ -0,0 +1,277 @@
+#pragma once
+
+/**
+ * @file coro.hpp
+ * @brief C++20 coroutine support for channels: a lazy Task<T> and a single-threaded scheduler.
+ *
+ * @details
+ * Everything in this header is only available when the compiler supports coroutines, which is
+ * reported through CHANNEL_HAS_COROUTINES. Under C++17 the header is empty, so channel.hpp and
+ * select.hpp can include it unconditionally.
+ *
+ * A coroutine that awaits a channel operation which cannot complete is parked on the channel as
+ * a waiter record, just like an async_send/async_receive. The counterpart operation (or close())
+ * resumes it: if the coroutine was suspended while running on a CoroScheduler the handle is
+ * posted back to that scheduler, otherwise it is resumed inline on the completing thread.
+ *
+ * CoroScheduler runs every coroutine on the thread that calls run(). Two coroutines handing
+ * values to each other over a channel on the same scheduler never block a thread or switch
+ * OS contexts; a handoff is a queue push and a resume.
+ */
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+#define CHANNEL_HAS_COROUTINES 1
+#else
+#define CHANNEL_HAS_COROUTINES 0
+#endif
+
+#if CHANNEL_HAS_COROUTINES
+
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Lazily started coroutine producing a T. Starts when awaited and resumes its awaiter
+ * when it finishes.
+ *
+ * @tparam T Result type, or void.
+ */
+template <typename T = void>
+class Task;
+
+namespace channel_detail {
+
+// Promise state shared by Task<T> and Task<void>
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;  // Coroutine awaiting this task
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Hand control straight back to the awaiter without growing the stack
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept {
+            std::coroutine_handle<> next = self.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() { error = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+
+    Task<T> get_return_object();
+
+    template <typename U>
+    void return_value(U &&result) { value.emplace(std::forward<U>(result)); }
+
+    T result() {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object();
+
+    void return_void() {}
+
+    void result() {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+}  // namespace channel_detail
+
+template <typename T>
+class Task {
+   public:
+    using promise_type = channel_detail::TaskPromise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    explicit Task(handle_type handle) : handle_(handle) {}
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task &operator=(Task &&other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+
+    // Start the task and resume `awaiter` when it finishes
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept {
+        handle_.promise().continuation = awaiter;
+        return handle_;
+    }
+
+    T await_resume() { return handle_.promise().result(); }
+
+   private:
+    handle_type handle_;
+};
+
+namespace channel_detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+}  // namespace channel_detail
+
+/**
+ * @brief Runs coroutines on the thread that calls run().
+ *
+ * spawn() and run() belong to the scheduler's thread; post() may be called from any thread, which
+ * is how a channel operation completed by another thread hands a coroutine back.
+ */
+class CoroScheduler {
+   public:
+    CoroScheduler() = default;
+    CoroScheduler(const CoroScheduler &) = delete;
+    CoroScheduler &operator=(const CoroScheduler &) = delete;
+
+    /**
+     * @brief Takes ownership of a task and queues it to start on the next run().
+     */
+    void spawn(Task<void> task);
+
+    /**
+     * @brief Queues a suspended coroutine to be resumed by run(). Thread-safe.
+     */
+    void post(std::coroutine_handle<> handle);
+
+    /**
+     * @brief Resumes queued coroutines until every spawned task has finished.
+     * Sleeps while all remaining tasks are suspended on operations owned by other threads.
+     * @throws The first exception that escaped a spawned task, once all tasks have finished.
+     */
+    void run();
+
+    /**
+     * @brief The scheduler whose run() is executing on this thread, or nullptr.
+     */
+    static CoroScheduler *current() { return current_; }
+
+   private:
+    // Fire-and-forget frame that owns a spawned task and reports when it is done
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    static Detached run_detached(CoroScheduler *scheduler, Task<void> task);
+    void finished(std::exception_ptr error);
+
+    std::mutex mtx_;
+    std::condition_variable cv_;                 // Signals posts from other threads
+    std::deque<std::coroutine_handle<>> ready_;  // Coroutines waiting to be resumed
+    std::size_t live_ = 0;                       // Spawned tasks that have not finished
+    std::exception_ptr error_;                   // First exception escaping a task
+
+    static inline thread_local CoroScheduler *current_ = nullptr;
+};
+
+namespace channel_detail {
+
+// Resume a coroutine on the scheduler it was suspended on, or inline if there is none
+inline void resume_on(std::coroutine_handle<> handle, CoroScheduler *scheduler) {
+    if (scheduler) {
+        scheduler->post(handle);
+    } else {
+        handle.resume();
+    }
+}
+
+}  // namespace channel_detail
+
+// Spawn - Wrap the task so its completion is counted
+inline void CoroScheduler::spawn(Task<void> task) {
+    Detached frame = run_detached(this, std::move(task));
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        live_++;
+    }
+    post(frame.handle);
+}
+
+inline CoroScheduler::Detached CoroScheduler::run_detached(CoroScheduler *scheduler, Task<void> task) {
+    std::exception_ptr error;
+    try {
+        co_await task;
+    } catch (...) {
+        error = std::current_exception();
+    }
+    scheduler->finished(error);
+}
+
+inline void CoroScheduler::finished(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (error && !error_) error_ = error;
+    live_--;
+}
+
+// Post - May come from any thread
+inline void CoroScheduler::post(std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    ready_.push_back(handle);
+    cv_.notify_one();
+}
+
+// Run loop - Resume in FIFO order, sleep only while every live task waits on another thread
+inline void CoroScheduler::run() {
+    CoroScheduler *outer = current_;
+    current_ = this;
+
+    while (true) {
+        std::coroutine_handle<> next;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            cv_.wait(lock, [this]() { return !ready_.empty() || live_ == 0; });
+            if (ready_.empty()) break;
+            next = ready_.front();
+            ready_.pop_front();
+        }
+        next.resume();
+    }
+
+    current_ = outer;
+    if (std::exception_ptr error = std::exchange(error_, nullptr)) std::rethrow_exception(error);
+}
+
+#endif  // CHANNEL_HAS_COROUTINES
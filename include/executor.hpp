@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file executor.hpp
+ * @brief Declaration of the executor interface used to run channel completions, plus a default thread pool.
+ *
+ * @details
+ * Channel<T> never dedicates a thread to a pending async operation. Pending operations are parked
+ * on the channel and completed by the peer operation; when the caller asked for a callback, that
+ * callback is handed to an Executor instead of running on the peer's thread.
+ *
+ * ThreadPoolExecutor is the default: a fixed number of workers, each with its own task deque.
+ * Tasks submitted from a worker go to that worker's deque (newest first, to keep caches warm);
+ * idle workers steal the oldest task from the other deques before going to sleep.
+ */
+
+class Executor {
+   public:
+    virtual ~Executor() = default;
+
+    /**
+     * @brief Schedules a task to run. Must not run the task inline on the caller's stack.
+     * @param task The task to run.
+     */
+    virtual void execute(std::function<void()> task) = 0;
+};
+
+class ThreadPoolExecutor : public Executor {
+   public:
+    /**
+     * @brief Starts a pool with a fixed number of worker threads.
+     * @param threads Number of workers; 0 picks std::thread::hardware_concurrency().
+     */
+    explicit ThreadPoolExecutor(std::size_t threads = 0);
+
+    /**
+     * @brief Runs every task that was already submitted, then joins the workers.
+     */
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+    ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+    void execute(std::function<void()> task) override;
+
+    /**
+     * @brief Number of worker threads.
+     */
+    std::size_t size() const { return workers_.size(); }
+
+   private:
+    struct Worker {
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+        std::thread thread;
+    };
+
+    void worker_loop(std::size_t self);
+    bool try_take(std::size_t self, std::function<void()> &task);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<std::size_t> next_worker_{0};  // Round-robin target for tasks submitted from outside the pool
+    std::atomic<std::size_t> pending_{0};      // Submitted but not yet taken tasks
+
+    std::mutex idle_mtx_;
+    std::condition_variable idle_cv_;  // Idle workers sleep here until a task is submitted
+    bool stopping_ = false;
+};
+
+/**
+ * @brief Process-wide executor used by channels that were not given one explicitly.
+ * @return A ThreadPoolExecutor with up to 4 workers, created on first use.
+ */
+inline Executor &default_executor();
+
+namespace channel_detail {
+// Index of the pool worker running on this thread, so resubmitted work stays local
+inline thread_local const void *current_pool = nullptr;
+inline thread_local std::size_t current_worker = 0;
+}  // namespace channel_detail
+
+// Constructor - Spawn the workers
+inline ThreadPoolExecutor::ThreadPoolExecutor(std::size_t threads) {
+    if (threads == 0) threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    for (std::size_t i = 0; i < threads; i++) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < threads; i++) {
+        workers_[i]->thread = std::thread([this, i]() { worker_loop(i); });
+    }
+}
+
+// Destructor - Let the workers drain what is queued, then join them
+inline ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(idle_mtx_);
+        stopping_ = true;
+    }
+    idle_cv_.notify_all();
+    for (auto &w : workers_) {
+        w->thread.join();
+    }
+}
+
+// Submit a task - Local deque when called from a worker, round-robin otherwise
+inline void ThreadPoolExecutor::execute(std::function<void()> task) {
+    std::size_t target = channel_detail::current_pool == this
+                             ? channel_detail::current_worker
+                             : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+        std::lock_guard<std::mutex> lock(workers_[target]->mtx);
+        workers_[target]->tasks.push_back(std::move(task));
+    }
+
+    pending_.fetch_add(1, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(idle_mtx_);  // Orders the increment with a worker about to sleep
+    idle_cv_.notify_one();
+}
+
+// Take the newest local task, or steal the oldest task from another worker
+inline bool ThreadPoolExecutor::try_take(std::size_t self, std::function<void()> &task) {
+    {
+        Worker &own = *workers_[self];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1; i < workers_.size(); i++) {
+        Worker &victim = *workers_[(self + i) % workers_.size()];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+// Worker loop - Run tasks until stopped and nothing is left
+inline void ThreadPoolExecutor::worker_loop(std::size_t self) {
+    channel_detail::current_pool = this;
+    channel_detail::current_worker = self;
+
+    std::function<void()> task;
+    while (true) {
+        if (try_take(self, task)) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idle_mtx_);
+        idle_cv_.wait(lock, [this]() { return pending_.load(std::memory_order_acquire) > 0 || stopping_; });
+        if (stopping_ && pending_.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+// Lazily created shared pool
+inline Executor &default_executor() {
+    static ThreadPoolExecutor pool(std::min<std::size_t>(4, std::max(1u, std::thread::hardware_concurrency())));
+    return pool;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file mpmc_ring.hpp
+ * @brief Declaration of a bounded lock-free multi-producer/multi-consumer ring buffer.
+ *
+ * @details
+ * MpmcRing<T> is the storage engine behind buffered Channel<T>. It follows Dmitry Vyukov's
+ * bounded MPMC queue: every slot carries a sequence number that tells producers and consumers
+ * whose turn it is, so a push or pop is a single CAS on the shared tail/head counter plus one
+ * release store on the slot.
+ *
+ * Sequence numbers are doubled (a slot is free for position `p` when its sequence is `2p` and
+ * holds a value for position `p` when it is `2p + 1`) so that a capacity of one is just as
+ * exact as any other capacity. Power-of-two capacities index slots with a mask; any other
+ * capacity falls back to a modulo so the bound stays exactly what the caller asked for.
+ *
+ * A value whose constructor throws after its slot was claimed leaves the slot poisoned: it is
+ * published without a value, and the pop that claims it frees it and moves on to the next
+ * position. Poisoned slots count towards size() until then.
+ *
+ * @note The head and tail counters live on separate cache lines (see cache_line_size) so
+ *       producers and consumers do not invalidate each other on every operation.
+ *
+ * @tparam T The type of elements stored in the ring.
+ */
+
+namespace channel_detail {
+
+// Distance that keeps independently written fields from false sharing. Uses the standard library's
+// hardware_destructive_interference_size when available and 64 otherwise. The value is baked into
+// the layout of every channel type, so code compiled with different -mtune/-mcpu flags that shares
+// channels should pin it with -DCHANNEL_CACHE_LINE_SIZE=<bytes>.
+#if defined(CHANNEL_CACHE_LINE_SIZE)
+inline constexpr std::size_t cache_line_size = CHANNEL_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+template <typename T>
+class MpmcRing {
+   public:
+    /**
+     * @brief Constructs a ring able to hold exactly `capacity` elements.
+     * @param capacity Number of slots. A capacity of 0 allocates nothing and the ring is always full.
+     * @param resource Where the slots are allocated; all of them up front, nothing after that.
+     */
+    explicit MpmcRing(std::size_t capacity, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    ~MpmcRing();
+
+    MpmcRing(const MpmcRing &) = delete;
+    MpmcRing &operator=(const MpmcRing &) = delete;
+
+    /**
+     * @brief Non-blocking push.
+     * @param value The value to store; forwarded into the slot.
+     * @return true if stored, false if the ring is full.
+     */
+    template <typename U>
+    bool try_push(U &&value) {
+        return try_emplace(std::forward<U>(value));
+    }
+
+    /**
+     * @brief Non-blocking in-place construction at the tail.
+     * @param args Constructor arguments for T. Left untouched if the ring is full.
+     * @return true if constructed, false if the ring is full.
+     * @note If constructing T from `args` may throw and T has a noexcept move constructor, the value
+     *       is built before a slot is claimed and then moved in, so a throw leaves the ring as it was.
+     *       Should the ring fill up in between, the value is dropped and rvalue `args` may have been
+     *       moved from. Otherwise a throw poisons the claimed slot and propagates.
+     */
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+
+    /**
+     * @brief Non-blocking pop.
+     * @return The oldest element, or std::nullopt if the ring is empty.
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Non-blocking bulk push. Claims up to `n` consecutive slots with a single CAS.
+     * @param first Iterator to the first element; advanced past every element stored.
+     * @param n Maximum number of elements to store.
+     * @return Number of elements stored (0 if the ring is full).
+     * @note If copying an element may throw and T has a noexcept move constructor, elements are
+     *       built and claimed one at a time; otherwise the failing slot and the rest of the claim are
+     *       poisoned. Either way a copy that throws after some elements were stored ends the push
+     *       early and `first` is left at the failing element, so the next push tries it again.
+     */
+    template <typename InputIt>
+    std::size_t try_push_bulk(InputIt &first, std::size_t n);
+
+    /**
+     * @brief Non-blocking bulk pop. Claims up to `n` consecutive published slots with a single CAS.
+     * @param out Output iterator the elements are moved into; advanced past every element written.
+     * @param n Maximum number of elements to pop.
+     * @return Number of elements popped (0 if the ring is empty).
+     * @note If writing an element to `out` throws, that element and the rest of the claim are
+     *       destroyed and their slots freed before the exception propagates.
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt &out, std::size_t n);
+
+    /**
+     * @brief Checks whether the oldest slot currently holds a published value.
+     * @return true if a pop would find nothing right now.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Checks whether the slot at the tail is still occupied by the previous lap.
+     * @return true if a push would fail right now.
+     */
+    bool full() const;
+
+    /**
+     * @brief Approximate number of stored elements (exact when no operation is in flight).
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Number of slots the ring was created with.
+     */
+    std::size_t capacity() const { return capacity_; }
+
+   private:
+    struct Slot {
+        std::atomic<std::size_t> seq;
+        bool poisoned = false;  // Published without a value; written before seq's release store
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T *value() { return std::launder(reinterpret_cast<T *>(&storage)); }
+    };
+
+    std::size_t index(std::size_t pos) const { return pow2_ ? (pos & mask_) : (pos % capacity_); }
+
+    // Constructs T in a claimed slot and publishes it; poisons the slot and rethrows if construction throws
+    template <typename... Args>
+    void publish(Slot &slot, std::size_t pos, Args &&...args);
+
+    // Publishes a claimed slot without a value
+    void poison(Slot &slot, std::size_t pos);
+
+    // Frees a popped poisoned slot for the next lap
+    void release_poisoned(Slot &slot, std::size_t pos);
+
+    // Frees a popped slot for the next lap, destroying its value if it has one
+    void release(Slot &slot, std::size_t pos);
+
+    alignas(cache_line_size) std::atomic<std::size_t> head_{0};  // Next position to pop
+    alignas(cache_line_size) std::atomic<std::size_t> tail_{0};  // Next position to push
+
+    alignas(cache_line_size) Slot *slots_ = nullptr;
+    std::pmr::memory_resource *resource_;
+    std::size_t capacity_;
+    std::size_t mask_;
+    bool pow2_;
+};
+
+}  // namespace channel_detail
+
+#include "mpmc_ring.tpp"
@@ -0,0 +1,267 @@
+#pragma once
+
+namespace channel_detail {
+
+// Constructor - Every slot starts free for its first lap
+template <typename T>
+MpmcRing<T>::MpmcRing(std::size_t capacity, std::pmr::memory_resource *resource)
+    : resource_(resource), capacity_(capacity), mask_(capacity - 1), pow2_(capacity != 0 && (capacity & (capacity - 1)) == 0) {
+    if (capacity_ == 0) return;
+
+    slots_ = static_cast<Slot *>(resource_->allocate(capacity_ * sizeof(Slot), alignof(Slot)));
+    for (std::size_t i = 0; i < capacity_; i++) {
+        new (&slots_[i]) Slot;
+        slots_[i].seq.store(2 * i, std::memory_order_relaxed);
+    }
+}
+
+// Destructor - Destroy whatever is still buffered and give the slots back
+template <typename T>
+MpmcRing<T>::~MpmcRing() {
+    if (!slots_) return;
+
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t pos = head; pos != tail; pos++) {
+        Slot &slot = slots_[index(pos)];
+        if (!slot.poisoned) slot.value()->~T();
+    }
+    resource_->deallocate(slots_, capacity_ * sizeof(Slot), alignof(Slot));
+}
+
+// Non-blocking emplace - Claim the tail position whose slot is free for this lap
+template <typename T>
+template <typename... Args>
+bool MpmcRing<T>::try_emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...> && std::is_nothrow_move_constructible_v<T>) {
+        // Build first, so a throwing constructor never gets as far as claiming a slot
+        if (full()) return false;  // Don't build a value there is no room for
+        return try_emplace(T(std::forward<Args>(args)...));
+    }
+
+    if (capacity_ == 0) return false;
+
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+        slot = &slots_[index(pos)];
+        std::size_t seq = slot->seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(2 * pos);
+
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;  // Slot still holds the previous lap's value, ring is full
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);  // Another producer got here first
+        }
+    }
+
+    publish(*slot, pos, std::forward<Args>(args)...);
+    return true;
+}
+
+// Publish a claimed slot - A constructor that throws publishes it poisoned instead, so pops step over it
+template <typename T>
+template <typename... Args>
+void MpmcRing<T>::publish(Slot &slot, std::size_t pos, Args &&...args) {
+    try {
+        new (&slot.storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+        poison(slot, pos);
+        throw;
+    }
+    slot.seq.store(2 * pos + 1, std::memory_order_release);
+}
+
+template <typename T>
+void MpmcRing<T>::poison(Slot &slot, std::size_t pos) {
+    slot.poisoned = true;
+    slot.seq.store(2 * pos + 1, std::memory_order_release);
+}
+
+// Hand a popped poisoned slot to the next lap
+template <typename T>
+void MpmcRing<T>::release_poisoned(Slot &slot, std::size_t pos) {
+    slot.poisoned = false;
+    slot.seq.store(2 * (pos + capacity_), std::memory_order_release);
+}
+
+// Hand a claimed slot to the next lap, destroying whatever it still holds
+template <typename T>
+void MpmcRing<T>::release(Slot &slot, std::size_t pos) {
+    if (slot.poisoned) return release_poisoned(slot, pos);
+    slot.value()->~T();
+    slot.seq.store(2 * (pos + capacity_), std::memory_order_release);
+}
+
+// Non-blocking pop - Claim the head position whose slot has been published
+template <typename T>
+std::optional<T> MpmcRing<T>::try_pop() {
+    if (capacity_ == 0) return std::nullopt;
+
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+        slot = &slots_[index(pos)];
+        std::size_t seq = slot->seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(2 * pos + 1);
+
+        if (diff == 0) {
+            if (!head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) continue;
+            if (!slot->poisoned) break;
+            release_poisoned(*slot, pos);  // Nothing was built there; take the next position instead
+            pos = head_.load(std::memory_order_relaxed);
+        } else if (diff < 0) {
+            return std::nullopt;  // Nothing published at the head yet, ring is empty
+        } else {
+            pos = head_.load(std::memory_order_relaxed);  // Another consumer got here first
+        }
+    }
+
+    T *stored = slot->value();
+    std::optional<T> value(std::move(*stored));
+    stored->~T();
+    slot->seq.store(2 * (pos + capacity_), std::memory_order_release);
+    return value;
+}
+
+// Non-blocking bulk push - Count the free slots from the tail for this lap, then claim them all at once
+template <typename T>
+template <typename InputIt>
+std::size_t MpmcRing<T>::try_push_bulk(InputIt &first, std::size_t n) {
+    if constexpr (!std::is_nothrow_constructible_v<T, decltype(*first)> && std::is_nothrow_move_constructible_v<T>) {
+        // Copies that may throw are built before their slot is claimed, so each element takes its own claim
+        std::size_t pushed = 0;
+        for (; pushed < n && !full(); pushed++, ++first) {
+            std::optional<T> value;
+            try {
+                value.emplace(*first);
+            } catch (...) {
+                if (pushed == 0) throw;
+                break;  // Report what was stored; the next push meets the exception again
+            }
+            if (!try_emplace(std::move(*value))) break;
+        }
+        return pushed;
+    }
+
+    if (capacity_ == 0 || n == 0) return 0;
+
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    std::size_t count;
+    while (true) {
+        auto diff = static_cast<std::intptr_t>(slots_[index(pos)].seq.load(std::memory_order_acquire)) -
+                    static_cast<std::intptr_t>(2 * pos);
+        if (diff < 0) return 0;  // Ring is full
+        if (diff > 0) {
+            pos = tail_.load(std::memory_order_relaxed);  // Another producer got here first
+            continue;
+        }
+
+        // A slot only ever goes from occupied to free until it is claimed, so this count stays valid
+        count = 1;
+        while (count < n && count < capacity_ &&
+               slots_[index(pos + count)].seq.load(std::memory_order_acquire) == 2 * (pos + count)) {
+            count++;
+        }
+        if (tail_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) break;
+    }
+
+    std::size_t i = 0;
+    try {
+        for (; i < count; i++, ++first) publish(slots_[index(pos + i)], pos + i, *first);
+    } catch (...) {
+        // Slot i is poisoned already; the rest of the claim will never get a value either
+        for (std::size_t j = i + 1; j < count; j++) poison(slots_[index(pos + j)], pos + j);
+        if (i == 0) throw;
+        return i;  // Report what was stored; the next push meets the exception again
+    }
+    return count;
+}
+
+// Non-blocking bulk pop - Count the published slots from the head, then claim them all at once
+template <typename T>
+template <typename OutputIt>
+std::size_t MpmcRing<T>::try_pop_bulk(OutputIt &out, std::size_t n) {
+    if (capacity_ == 0 || n == 0) return 0;
+
+    while (true) {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        std::size_t count;
+        while (true) {
+            auto diff = static_cast<std::intptr_t>(slots_[index(pos)].seq.load(std::memory_order_acquire)) -
+                        static_cast<std::intptr_t>(2 * pos + 1);
+            if (diff < 0) return 0;  // Ring is empty
+            if (diff > 0) {
+                pos = head_.load(std::memory_order_relaxed);  // Another consumer got here first
+                continue;
+            }
+
+            // A published slot stays published until it is claimed, so this count stays valid
+            count = 1;
+            while (count < n && count < capacity_ &&
+                   slots_[index(pos + count)].seq.load(std::memory_order_acquire) == 2 * (pos + count) + 1) {
+                count++;
+            }
+            if (head_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) break;
+        }
+
+        std::size_t popped = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            Slot &slot = slots_[index(pos + i)];
+            if (slot.poisoned) {
+                release(slot, pos + i);
+                continue;
+            }
+            T *stored = slot.value();
+            try {
+                *out = std::move(*stored);
+            } catch (...) {
+                // The claim can't be handed back, so drop this element and the rest of it to free their slots
+                for (std::size_t j = i; j < count; j++) release(slots_[index(pos + j)], pos + j);
+                throw;
+            }
+            ++out;
+            popped++;
+            release(slot, pos + i);
+        }
+        if (popped > 0) return popped;  // Otherwise every claimed slot was poisoned; claim again
+    }
+}
+
+// Check whether the head slot has a published value
+template <typename T>
+bool MpmcRing<T>::empty() const {
+    if (capacity_ == 0) return true;
+
+    std::size_t pos = head_.load(std::memory_order_acquire);
+    return slots_[index(pos)].seq.load(std::memory_order_acquire) != 2 * pos + 1;
+}
+
+// Check whether the tail slot is still waiting for a pop
+template <typename T>
+bool MpmcRing<T>::full() const {
+    if (capacity_ == 0) return true;
+
+    std::size_t pos = tail_.load(std::memory_order_acquire);
+    while (true) {
+        std::size_t seq = slots_[index(pos)].seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(2 * pos);
+        if (diff <= 0) return diff < 0;
+
+        std::size_t next = tail_.load(std::memory_order_acquire);  // Producers moved on since we read tail_
+        if (next == pos) return false;
+        pos = next;
+    }
+}
+
+// Approximate element count
+template <typename T>
+std::size_t MpmcRing<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+}  // namespace channel_detail
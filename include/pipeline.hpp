@@ -0,0 +1,266 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "channel.hpp"
+
+/**
+ * @file pipeline.hpp
+ * @brief Declaration of pipeline combinators (map, filter, batch, merge, split, tee) over channels.
+ *
+ * @details
+ * A Pipeline<T> describes a stream of items that starts at one or more channels. Building one
+ * starts nothing: map() and filter() are fused into the stage that follows them, so
+ * `from(in).map(f).filter(p).map(g).to(out)` runs f, p and g back to back on one worker thread
+ * per lane, with no channel between them. A lane is one independent pull path from a source
+ * channel to the end of the pipeline; the terminal (to() or for_each()) starts one worker per lane.
+ *
+ * Lanes are rooted at channels, so a pipeline can open the same lane several times: merge()
+ * gives each source channel its own lane, split() hands the same lanes to several branches, and
+ * map() with parallelism N opens each lane N times. None of these adds a channel hop. Only tee(),
+ * an order-preserving parallel map() and a batch() after other stages need one, and run their
+ * own workers into a channel of stage_capacity() items.
+ *
+ * Ordering: a single lane with no parallelism keeps the source's order end to end. Parallel
+ * lanes interleave, except after `map(f, n, StageOrder::Preserve)`, which emits in input order.
+ *
+ * Sources are drained with the channel's range iterator, so each worker takes buffered items a
+ * chunk at a time. A stage that throws stops its worker; the terminal still closes its sink once
+ * every worker is done, and PipelineRun::join() rethrows the first exception. A channel the
+ * pipeline added is closed once every worker reading it has stopped, so the workers feeding a
+ * failed stage stop at their next send instead of blocking on it. Sources are never closed by
+ * the pipeline: a producer that outlives the workers draining its source can still block on it.
+ *
+ * @note A Pipeline value is a recipe: use each one in exactly one further step (a transform,
+ *       split(), tee() or a terminal). Every branch must end in a terminal, and the sources must
+ *       eventually be closed, or the workers never finish.
+ *
+ * @tparam T The type of items flowing through this point of the pipeline.
+ */
+
+/**
+ * @brief Whether a parallel map() may reorder items.
+ */
+enum class StageOrder {
+    Any,       // Emit each result as soon as it is ready
+    Preserve,  // Emit results in input order; a slow item holds back the ones after it
+};
+
+namespace channel_detail {
+
+// Worker threads of one pipeline, shared by every Pipeline and PipelineRun built from it
+class PipelineGraph {
+   public:
+    explicit PipelineGraph(std::size_t stage_capacity) : stage_capacity_(stage_capacity) {}
+
+    ~PipelineGraph() { join_workers(); }  // Nobody is left to see a failure, so error_ is dropped
+
+    PipelineGraph(const PipelineGraph &) = delete;
+    PipelineGraph &operator=(const PipelineGraph &) = delete;
+
+    // Runs `body` on a new worker, then `on_exit` even if body threw
+    template <typename Body, typename OnExit>
+    void spawn(Body body, OnExit on_exit) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        workers_.emplace_back([this, body = std::move(body), on_exit = std::move(on_exit)]() mutable {
+            try {
+                body();
+            } catch (...) {
+                fail(std::current_exception());
+            }
+            on_exit();
+        });
+    }
+
+    // Keeps the first exception a worker reports
+    void fail(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!error_) error_ = error;
+    }
+
+    // Waits for every worker started so far, then rethrows the first failure
+    void join() {
+        join_workers();
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (error_) std::rethrow_exception(error_);
+    }
+
+    std::size_t stage_capacity() const { return stage_capacity_; }
+
+   private:
+    void join_workers() {
+        std::vector<std::thread> workers;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            workers.swap(workers_);
+        }
+        for (auto &w : workers) w.join();
+    }
+
+    const std::size_t stage_capacity_;
+    std::mutex mtx_;
+    std::vector<std::thread> workers_;
+    std::exception_ptr error_;
+};
+
+}  // namespace channel_detail
+
+/**
+ * @brief Handle on the workers a terminal started.
+ *
+ * Destroying a PipelineRun does not wait for anything by itself. The workers are joined by
+ * join(), or else when the last Pipeline or PipelineRun sharing the graph goes away; a stage's
+ * exception is only reported through join() and is discarded in the second case.
+ */
+class PipelineRun {
+   public:
+    explicit PipelineRun(std::shared_ptr<channel_detail::PipelineGraph> graph) : graph_(std::move(graph)) {}
+
+    /**
+     * @brief Waits until every worker of the pipeline has finished.
+     * @throws The first exception a stage threw, if any.
+     */
+    void join() { graph_->join(); }
+
+   private:
+    std::shared_ptr<channel_detail::PipelineGraph> graph_;
+};
+
+template <typename T>
+class Pipeline {
+   public:
+    // Capacity of the channels tee() and an order-preserving map() put between stages
+    static constexpr std::size_t default_stage_capacity = 1024;
+
+    /**
+     * @brief Starts a pipeline that receives from `source`.
+     * @param source Must outlive the pipeline's workers; close it to let the pipeline finish.
+     * @param stage_capacity Capacity of any channel the pipeline adds between stages.
+     */
+    static Pipeline from(Channel<T> &source, std::size_t stage_capacity = default_stage_capacity);
+
+    /**
+     * @brief Starts a pipeline that receives from every channel given, one lane per channel.
+     * Items from one source keep their order; items from different sources interleave. merge()
+     * adds no channel hop itself; later stages that do use default_stage_capacity.
+     */
+    template <typename... Rest>
+    static Pipeline merge(Channel<T> &first, Rest &...rest);
+
+    /**
+     * @brief merge() over a list of sources.
+     * @param sources Each must outlive the pipeline's workers.
+     * @param stage_capacity Capacity of any channel later stages add, as for from().
+     * @throws invalid_argument if sources is empty.
+     */
+    static Pipeline merge(const std::vector<Channel<T> *> &sources, std::size_t stage_capacity = default_stage_capacity);
+
+    /**
+     * @brief Applies `f` to every item. Fused into the stage that follows.
+     * @param f Called as `f(T&&)`; must be safe to call from several workers at once if parallelism > 1.
+     * @param parallelism Number of workers per lane that run `f`.
+     * @param order With StageOrder::Preserve and parallelism > 1, results leave in input order,
+     *        through one channel hop.
+     * @throws invalid_argument if parallelism is 0.
+     */
+    template <typename F>
+    auto map(F f, std::size_t parallelism = 1, StageOrder order = StageOrder::Any)
+        -> Pipeline<std::decay_t<std::invoke_result_t<F &, T &&>>>;
+
+    /**
+     * @brief Keeps only the items for which `pred(const T&)` is true. Fused into the stage that follows.
+     */
+    template <typename P>
+    Pipeline filter(P pred);
+
+    /**
+     * @brief Groups items into vectors of up to `n`, emitting a partial group once `max_delay` has
+     * passed since its first item. Each lane batches its own items. It waits on a channel for the
+     * deadline, so any stages before it first run into one channel (one hop).
+     * @throws invalid_argument if n is 0.
+     */
+    template <typename Rep, typename Period>
+    Pipeline<std::vector<T>> batch(std::size_t n, const std::chrono::duration<Rep, Period> &max_delay);
+
+    /**
+     * @brief Splits the stream into `n` branches; each item goes to exactly one of them, whichever
+     * asks first. Fused: every branch pulls straight from the lanes.
+     * @throws invalid_argument if n is 0.
+     */
+    std::vector<Pipeline> split(std::size_t n);
+
+    /**
+     * @brief Copies every item into each of `n` branches. The slowest branch paces the others.
+     * @throws invalid_argument if n is 0.
+     */
+    std::vector<Pipeline> tee(std::size_t n = 2);
+
+    /**
+     * @brief Terminal: starts the workers, which send every item to `sink` and close it at the end.
+     * @param sink Must outlive the workers.
+     */
+    [[nodiscard]] PipelineRun to(Channel<T> &sink);
+
+    /**
+     * @brief Terminal: starts the workers, which call `f(T&&)` on every item. With several lanes
+     * `f` runs on several threads at once.
+     */
+    template <typename F>
+    [[nodiscard]] PipelineRun for_each(F f);
+
+    /**
+     * @brief Number of workers a terminal would start here.
+     */
+    std::size_t lanes() const { return lanes_.size(); }
+
+    std::size_t stage_capacity() const { return graph_->stage_capacity(); }
+
+   private:
+    template <typename>
+    friend class Pipeline;
+
+    // Pulls the lane's next item; std::nullopt once its source is closed and drained
+    using Puller = std::function<std::optional<T>()>;
+
+    struct Lane {
+        std::function<Puller()> open;       // Each call starts an independent pull path
+        std::shared_ptr<Channel<T>> source;  // Set while the lane is a bare channel with no stages
+    };
+
+    Pipeline(std::shared_ptr<channel_detail::PipelineGraph> graph, std::vector<Lane> lanes)
+        : graph_(std::move(graph)), lanes_(std::move(lanes)) {}
+
+    static Lane channel_lane(std::shared_ptr<Channel<T>> source);
+
+    // A lane on a channel the pipeline added, closed once nothing pulls from it any more
+    static Lane stage_lane(std::shared_ptr<Channel<T>> channel);
+
+    // Starts one worker per lane that runs `each` on every item; the last one to finish runs `done`
+    template <typename Each, typename Done>
+    void run_lanes(Each each, Done done);
+
+    // Runs the lanes into a new channel and returns a pipeline over it: one lane, bare
+    Pipeline materialize();
+
+    template <typename U, typename F>
+    Pipeline<U> map_ordered(F f, std::size_t parallelism);
+
+    std::shared_ptr<channel_detail::PipelineGraph> graph_;
+    std::vector<Lane> lanes_;
+};
+
+#include "pipeline.tpp"
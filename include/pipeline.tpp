@@ -0,0 +1,290 @@
+#pragma once
+
+// from - One bare lane on a channel the caller owns
+template <typename T>
+Pipeline<T> Pipeline<T>::from(Channel<T> &source, std::size_t stage_capacity) {
+    auto graph = std::make_shared<channel_detail::PipelineGraph>(stage_capacity);
+    std::shared_ptr<Channel<T>> unowned(std::shared_ptr<Channel<T>>(), &source);
+    return Pipeline(std::move(graph), {channel_lane(std::move(unowned))});
+}
+
+// merge - One bare lane per source channel
+template <typename T>
+template <typename... Rest>
+Pipeline<T> Pipeline<T>::merge(Channel<T> &first, Rest &...rest) {
+    static_assert((std::is_same_v<Rest, Channel<T>> && ...), "merge() takes channels of the same item type");
+    return merge({&first, &rest...});
+}
+
+template <typename T>
+Pipeline<T> Pipeline<T>::merge(const std::vector<Channel<T> *> &sources, std::size_t stage_capacity) {
+    if (sources.empty()) {
+        throw std::invalid_argument("Pipeline merge needs at least one source");
+    }
+
+    auto graph = std::make_shared<channel_detail::PipelineGraph>(stage_capacity);
+    std::vector<Lane> lanes;
+    for (Channel<T> *source : sources) {
+        lanes.push_back(channel_lane(std::shared_ptr<Channel<T>>(std::shared_ptr<Channel<T>>(), source)));
+    }
+    return Pipeline(std::move(graph), std::move(lanes));
+}
+
+// Bare lane - Every pull path drains the channel through its own range iterator, a chunk at a time
+template <typename T>
+typename Pipeline<T>::Lane Pipeline<T>::channel_lane(std::shared_ptr<Channel<T>> source) {
+    Lane lane;
+    lane.source = source;
+    lane.open = [source]() -> Puller {
+        auto cursor = std::make_shared<std::optional<typename Channel<T>::Iterator>>();
+        return [source, cursor]() -> std::optional<T> {
+            auto &it = *cursor;
+            if (!it) {
+                it.emplace(source->begin());
+            } else if (*it != source->end()) {
+                ++*it;
+            }
+            if (*it == source->end()) return std::nullopt;  // Closed and drained
+            return std::move(**it);
+        };
+    };
+    return lane;
+}
+
+// Stage lane - A channel the pipeline added; closed once every pull path on it is gone, so when the
+// stages reading it fail, the workers feeding it stop at their next send instead of blocking
+template <typename T>
+typename Pipeline<T>::Lane Pipeline<T>::stage_lane(std::shared_ptr<Channel<T>> channel) {
+    Lane lane = channel_lane(channel);
+    auto readers = std::make_shared<std::atomic<std::size_t>>(0);
+    lane.open = [open = std::move(lane.open), channel, readers]() -> Puller {
+        readers->fetch_add(1, std::memory_order_relaxed);
+        std::shared_ptr<void> reader(nullptr, [channel, readers](void *) {
+            if (readers->fetch_sub(1, std::memory_order_acq_rel) == 1) channel->close();
+        });
+        return [pull = open(), reader]() { return pull(); };
+    };
+    return lane;
+}
+
+// map - Wraps each lane's pull path, opened `parallelism` times, so f runs on the worker that pulls
+template <typename T>
+template <typename F>
+auto Pipeline<T>::map(F f, std::size_t parallelism, StageOrder order)
+    -> Pipeline<std::decay_t<std::invoke_result_t<F &, T &&>>> {
+    using U = std::decay_t<std::invoke_result_t<F &, T &&>>;
+    if (parallelism == 0) {
+        throw std::invalid_argument("Pipeline map parallelism must be greater than 0");
+    }
+    if (order == StageOrder::Preserve && parallelism > 1) return map_ordered<U>(std::move(f), parallelism);
+
+    std::vector<typename Pipeline<U>::Lane> lanes;
+    for (const Lane &lane : lanes_) {
+        auto open = [open = lane.open, f]() {
+            return typename Pipeline<U>::Puller([prev = open(), f]() mutable -> std::optional<U> {
+                if (auto value = prev()) return f(std::move(*value));
+                return std::nullopt;
+            });
+        };
+        for (std::size_t i = 0; i < parallelism; i++) lanes.push_back({open, nullptr});
+    }
+    return Pipeline<U>(graph_, std::move(lanes));
+}
+
+// Order-preserving parallel map - Workers take sequence numbers as they pull and emit strictly in turn
+template <typename T>
+template <typename U, typename F>
+Pipeline<U> Pipeline<T>::map_ordered(F f, std::size_t parallelism) {
+    struct Turnstile {
+        std::mutex pull_mtx;  // Guards pull and next_in, so sequence numbers follow the input order
+        Puller pull;
+        std::uint64_t next_in = 0;
+
+        std::mutex emit_mtx;  // Guards next_out
+        std::condition_variable turn;
+        std::uint64_t next_out = 0;
+
+        std::atomic<std::size_t> running{0};
+    };
+
+    Pipeline upstream = lanes_.size() == 1 ? *this : materialize();
+    auto out = std::make_shared<Channel<U>>(stage_capacity());
+    auto turnstile = std::make_shared<Turnstile>();
+    turnstile->pull = upstream.lanes_.front().open();
+    turnstile->running = parallelism;
+
+    for (std::size_t i = 0; i < parallelism; i++) {
+        graph_->spawn(
+            [turnstile, out, f]() mutable {
+                Turnstile &ts = *turnstile;
+                while (true) {
+                    std::unique_lock<std::mutex> pull_lock(ts.pull_mtx);
+                    std::optional<T> item = ts.pull();
+                    if (!item) return;
+                    std::uint64_t seq = ts.next_in++;
+                    pull_lock.unlock();
+
+                    // A throwing f still takes its turn, or every later item would wait forever
+                    std::optional<U> result;
+                    std::exception_ptr error;
+                    try {
+                        result.emplace(f(std::move(*item)));
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+
+                    {
+                        std::unique_lock<std::mutex> emit_lock(ts.emit_mtx);
+                        ts.turn.wait(emit_lock, [&]() { return ts.next_out == seq; });
+                        if (result) {
+                            try {
+                                out->send(std::move(*result));
+                            } catch (...) {
+                                error = std::current_exception();  // Closed: every stage reading it is gone
+                            }
+                        }
+                        ts.next_out++;
+                    }
+                    ts.turn.notify_all();
+                    if (error) std::rethrow_exception(error);
+                }
+            },
+            [turnstile, out]() {
+                if (turnstile->running.fetch_sub(1, std::memory_order_acq_rel) == 1) out->close();
+            });
+    }
+    return Pipeline<U>(graph_, {Pipeline<U>::stage_lane(out)});
+}
+
+// filter - Wraps each lane's pull path; skipped items never leave the worker
+template <typename T>
+template <typename P>
+Pipeline<T> Pipeline<T>::filter(P pred) {
+    std::vector<Lane> lanes;
+    for (const Lane &lane : lanes_) {
+        lanes.push_back({[open = lane.open, pred]() {
+                             return Puller([prev = open(), pred]() mutable -> std::optional<T> {
+                                 while (auto value = prev()) {
+                                     if (pred(std::as_const(*value))) return value;
+                                 }
+                                 return std::nullopt;
+                             });
+                         },
+                         nullptr});
+    }
+    return Pipeline(graph_, std::move(lanes));
+}
+
+// batch - Needs the channel itself for its deadline, so stages before it are run into one first
+template <typename T>
+template <typename Rep, typename Period>
+Pipeline<std::vector<T>> Pipeline<T>::batch(std::size_t n, const std::chrono::duration<Rep, Period> &max_delay) {
+    if (n == 0) {
+        throw std::invalid_argument("Pipeline batch size must be greater than 0");
+    }
+
+    bool bare = true;
+    for (const Lane &lane : lanes_) bare = bare && lane.source != nullptr;
+    Pipeline upstream = bare ? *this : materialize();
+    auto wait = std::chrono::duration_cast<std::chrono::steady_clock::duration>(max_delay);
+
+    std::vector<typename Pipeline<std::vector<T>>::Lane> lanes;
+    for (const Lane &lane : upstream.lanes_) {
+        lanes.push_back({[source = lane.source, open = lane.open, n, wait]() {
+                             // Receives from the channel directly; the unused pull path only counts it as a reader
+                             return typename Pipeline<std::vector<T>>::Puller(
+                                 [source, reader = open(), n, wait]() -> std::optional<std::vector<T>> {
+                                     auto first = source->receive();
+                                     if (!first) return std::nullopt;
+
+                                     std::vector<T> group;
+                                     group.reserve(n);
+                                     group.push_back(std::move(*first));
+                                     auto deadline = std::chrono::steady_clock::now() + wait;
+                                     while (group.size() < n) {
+                                         if (source->try_receive_batch(std::back_inserter(group), n - group.size()) > 0) {
+                                             continue;
+                                         }
+                                         auto next = source->receive_until(deadline);
+                                         if (!next) break;  // Timed out, or closed and drained
+                                         group.push_back(std::move(*next));
+                                     }
+                                     return group;
+                                 });
+                         },
+                         nullptr});
+    }
+    return Pipeline<std::vector<T>>(graph_, std::move(lanes));
+}
+
+// split - Every branch opens the same lanes, so each item is pulled by exactly one of them
+template <typename T>
+std::vector<Pipeline<T>> Pipeline<T>::split(std::size_t n) {
+    if (n == 0) {
+        throw std::invalid_argument("Pipeline split needs at least one branch");
+    }
+    return std::vector<Pipeline>(n, *this);
+}
+
+// tee - One channel per branch; each lane's worker copies every item into all of them
+template <typename T>
+std::vector<Pipeline<T>> Pipeline<T>::tee(std::size_t n) {
+    if (n == 0) {
+        throw std::invalid_argument("Pipeline tee needs at least one branch");
+    }
+
+    std::vector<std::shared_ptr<Channel<T>>> outs;
+    for (std::size_t i = 0; i < n; i++) outs.push_back(std::make_shared<Channel<T>>(stage_capacity()));
+
+    run_lanes(
+        [outs](T &&value) {
+            for (std::size_t i = 0; i + 1 < outs.size(); i++) outs[i]->send(value);
+            outs.back()->send(std::move(value));
+        },
+        [outs]() {
+            for (auto &out : outs) out->close();
+        });
+
+    std::vector<Pipeline> branches;
+    for (auto &out : outs) branches.push_back(Pipeline(graph_, {stage_lane(out)}));
+    return branches;
+}
+
+// to - Terminal into a caller-owned channel
+template <typename T>
+PipelineRun Pipeline<T>::to(Channel<T> &sink) {
+    run_lanes([&sink](T &&value) { sink.send(std::move(value)); }, [&sink]() { sink.close(); });
+    return PipelineRun(graph_);
+}
+
+// for_each - Terminal that consumes on the lane workers themselves
+template <typename T>
+template <typename F>
+PipelineRun Pipeline<T>::for_each(F f) {
+    run_lanes([f](T &&value) mutable { f(std::move(value)); }, []() {});
+    return PipelineRun(graph_);
+}
+
+// Run every lane on its own worker - The last worker out runs `done`, even if some failed
+template <typename T>
+template <typename Each, typename Done>
+void Pipeline<T>::run_lanes(Each each, Done done) {
+    auto running = std::make_shared<std::atomic<std::size_t>>(lanes_.size());
+    for (const Lane &lane : lanes_) {
+        graph_->spawn(
+            [pull = lane.open(), each]() mutable {
+                while (auto value = pull()) each(std::move(*value));
+            },
+            [running, done]() mutable {
+                if (running->fetch_sub(1, std::memory_order_acq_rel) == 1) done();
+            });
+    }
+}
+
+// materialize - The one channel hop: run the lanes into a fresh channel and continue from it
+template <typename T>
+Pipeline<T> Pipeline<T>::materialize() {
+    auto out = std::make_shared<Channel<T>>(stage_capacity());
+    run_lanes([out](T &&value) { out->send(std::move(value)); }, [out]() { out->close(); });
+    return Pipeline(graph_, {stage_lane(out)});
+}
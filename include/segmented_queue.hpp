@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "mpmc_ring.hpp"
+#include "wait_strategy.hpp"
+
+/**
+ * @file segmented_queue.hpp
+ * @brief Declaration of an unbounded lock-free multi-producer/multi-consumer queue of linked blocks.
+ *
+ * @details
+ * SegmentedQueue<T> is the storage engine behind unbounded Channel<T>. It follows crossbeam's
+ * SegQueue: values live in fixed-size blocks chained through `next` pointers, and producers and
+ * consumers each advance a single index with one CAS. A push never fails and never waits for a
+ * consumer; at worst it waits a few instructions for another producer to link the next block.
+ *
+ * Indices count positions shifted left by one; the low bit of the head index records that the
+ * head block already has a successor, which lets consumers skip re-reading the tail. Each block
+ * has `lap` positions but only `block_capacity = lap - 1` slots: the last position is a gap the
+ * producer that filled the block parks on while it installs the next block.
+ *
+ * A block is released by whichever consumer reads its last slot, or, if an earlier slot is still
+ * being read at that moment, by that slot's reader (slot state bits hand the job over). Released
+ * blocks go to a small cache of spares that producers take from before allocating, so a queue
+ * whose depth stays bounded stops allocating once it has warmed up.
+ *
+ * A value whose constructor throws after its position was claimed leaves the slot poisoned: it is
+ * marked written without a value, and the pop that claims it moves on to the next position.
+ * Unless T's move constructor may throw, values that may throw are built before the claim instead.
+ *
+ * @tparam T The type of elements stored in the queue.
+ */
+
+namespace channel_detail {
+
+template <typename T>
+class SegmentedQueue {
+   public:
+    static constexpr std::size_t lap = 32;                 // Positions per block
+    static constexpr std::size_t block_capacity = lap - 1;  // Slots per block
+
+    /**
+     * @brief Constructs an empty queue with its first block.
+     * @param resource Where blocks are allocated. Must outlive the queue.
+     */
+    explicit SegmentedQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    ~SegmentedQueue();
+
+    SegmentedQueue(const SegmentedQueue &) = delete;
+    SegmentedQueue &operator=(const SegmentedQueue &) = delete;
+
+    template <typename U>
+    bool try_push(U &&value) {
+        return try_emplace(std::forward<U>(value));
+    }
+
+    /**
+     * @brief In-place construction at the tail. Never fails; the bool matches MpmcRing.
+     * @return true.
+     * @note A constructor that throws leaves the queue as it was, apart from a poisoned slot that
+     *       size() counts until a pop steps over it.
+     */
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+
+    /**
+     * @brief Non-blocking pop.
+     * @return The oldest element, or std::nullopt if the queue is empty.
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Pushes `n` elements, one position at a time.
+     * @param first Iterator to the first element; advanced past every element stored.
+     * @return n. A copy that throws after some elements were stored ends the push early instead;
+     *         `first` is left at the failing element, so the next push tries it again.
+     */
+    template <typename InputIt>
+    std::size_t try_push_bulk(InputIt &first, std::size_t n);
+
+    /**
+     * @brief Pops up to `n` elements.
+     * @param out Output iterator the elements are moved into; advanced past every element written.
+     * @return Number of elements popped (0 if the queue is empty).
+     * @note If writing an element to `out` throws, that element is destroyed and its slot freed
+     *       before the exception propagates, as in MpmcRing. Elements are popped one at a time,
+     *       so the ones after it stay queued.
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_bulk(OutputIt &out, std::size_t n);
+
+    bool empty() const;
+    bool full() const { return false; }
+
+    /**
+     * @brief Number of stored elements (exact when no operation is in flight).
+     */
+    std::size_t size() const;
+
+    std::size_t capacity() const { return std::numeric_limits<std::size_t>::max(); }
+
+   private:
+    static constexpr std::size_t shift = 1;     // Index bits below the position
+    static constexpr std::size_t has_next = 1;  // Head index flag: the head block has a successor
+
+    // Slot state bits
+    static constexpr unsigned written = 1;  // A producer stored the value
+    static constexpr unsigned read = 2;     // A consumer took it
+    static constexpr unsigned destroy = 4;  // The block's releaser left the rest to this slot's reader
+    static constexpr unsigned poisoned = 8;  // Set with `written`: the constructor threw, there is no value
+
+    struct Slot {
+        std::atomic<unsigned> state{0};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T *value() { return std::launder(reinterpret_cast<T *>(&storage)); }
+
+        void wait_written() const {
+            for (std::uint32_t round = 0; (state.load(std::memory_order_acquire) & written) == 0; round++) {
+                spin_pause(round);
+            }
+        }
+    };
+
+    struct Block {
+        std::atomic<Block *> next{nullptr};
+        std::array<Slot, block_capacity> slots;
+
+        Block *wait_next() const {
+            for (std::uint32_t round = 0;; round++) {
+                if (Block *n = next.load(std::memory_order_acquire)) return n;
+                spin_pause(round);
+            }
+        }
+    };
+
+    struct Position {
+        std::atomic<std::size_t> index{0};
+        std::atomic<Block *> block{nullptr};
+    };
+
+    // A spare block if one is cached, otherwise a fresh one
+    Block *acquire_block();
+
+    // Release `block` once slots from `start` on are read; a reader still busy finishes the job
+    void release_block(Block *block, std::size_t start);
+
+    // Cache a block no thread uses any more, or free it if the cache is full
+    void recycle(Block *block);
+
+    alignas(cache_line_size) Position head_;  // Next position to pop
+    alignas(cache_line_size) Position tail_;  // Next position to push
+
+    static constexpr std::size_t spare_blocks = 4;
+    alignas(cache_line_size) std::array<std::atomic<Block *>, spare_blocks> spares_{};
+    std::pmr::memory_resource *resource_;
+};
+
+}  // namespace channel_detail
+
+#include "segmented_queue.tpp"
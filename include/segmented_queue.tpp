@@ -0,0 +1,254 @@
+#pragma once
+
+namespace channel_detail {
+
+// Constructor - Start with one block so neither side has to handle an empty chain
+template <typename T>
+SegmentedQueue<T>::SegmentedQueue(std::pmr::memory_resource *resource) : resource_(resource) {
+    Block *first = acquire_block();
+    head_.block.store(first, std::memory_order_relaxed);
+    tail_.block.store(first, std::memory_order_relaxed);
+}
+
+// Destructor - Destroy whatever is still queued, then free the chain and the spares
+template <typename T>
+SegmentedQueue<T>::~SegmentedQueue() {
+    std::size_t head = head_.index.load(std::memory_order_relaxed) & ~has_next;
+    std::size_t tail = tail_.index.load(std::memory_order_relaxed) & ~has_next;
+    Block *block = head_.block.load(std::memory_order_relaxed);
+
+    for (; head != tail; head += std::size_t{1} << shift) {
+        std::size_t offset = (head >> shift) % lap;
+        if (offset < block_capacity) {
+            Slot &slot = block->slots[offset];
+            if ((slot.state.load(std::memory_order_relaxed) & poisoned) == 0) slot.value()->~T();
+        } else {
+            Block *next = block->next.load(std::memory_order_relaxed);
+            block->~Block();
+            resource_->deallocate(block, sizeof(Block), alignof(Block));
+            block = next;
+        }
+    }
+    if (block) {
+        block->~Block();
+        resource_->deallocate(block, sizeof(Block), alignof(Block));
+    }
+
+    for (auto &spare : spares_) {
+        if (Block *b = spare.load(std::memory_order_relaxed)) {
+            b->~Block();
+            resource_->deallocate(b, sizeof(Block), alignof(Block));
+        }
+    }
+}
+
+// Block cache - Slots only ever go from empty to holding a block by CAS and back by exchange, so there is no ABA
+template <typename T>
+typename SegmentedQueue<T>::Block *SegmentedQueue<T>::acquire_block() {
+    for (auto &spare : spares_) {
+        if (spare.load(std::memory_order_relaxed) == nullptr) continue;
+        if (Block *block = spare.exchange(nullptr, std::memory_order_acquire)) {
+            block->next.store(nullptr, std::memory_order_relaxed);
+            for (Slot &slot : block->slots) slot.state.store(0, std::memory_order_relaxed);
+            return block;
+        }
+    }
+    return ::new (resource_->allocate(sizeof(Block), alignof(Block))) Block();
+}
+
+template <typename T>
+void SegmentedQueue<T>::recycle(Block *block) {
+    for (auto &spare : spares_) {
+        Block *empty = nullptr;
+        if (spare.compare_exchange_strong(empty, block, std::memory_order_release, std::memory_order_relaxed)) return;
+    }
+    block->~Block();
+    resource_->deallocate(block, sizeof(Block), alignof(Block));
+}
+
+// Release a block - The reader of the last slot starts at 0; a reader that found `destroy` set resumes after its slot
+template <typename T>
+void SegmentedQueue<T>::release_block(Block *block, std::size_t start) {
+    // The last slot needs no flag: its reader is the one that started the release
+    for (std::size_t i = start; i + 1 < block_capacity; i++) {
+        Slot &slot = block->slots[i];
+        if ((slot.state.load(std::memory_order_acquire) & read) == 0 &&
+            (slot.state.fetch_or(destroy, std::memory_order_acq_rel) & read) == 0) {
+            return;  // Still being read; that reader continues from here
+        }
+    }
+    recycle(block);
+}
+
+// Emplace - Claim the tail position; the producer that takes a block's last slot links the next one
+template <typename T>
+template <typename... Args>
+bool SegmentedQueue<T>::try_emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...> && std::is_nothrow_move_constructible_v<T>) {
+        // Build first, so a throwing constructor never gets as far as claiming a position
+        return try_emplace(T(std::forward<Args>(args)...));
+    }
+
+    std::size_t tail = tail_.index.load(std::memory_order_acquire);
+    Block *block = tail_.block.load(std::memory_order_acquire);
+    Block *next_block = nullptr;
+
+    for (std::uint32_t round = 0;; round++) {
+        std::size_t offset = (tail >> shift) % lap;
+
+        // Another producer filled the block and is installing the next one
+        if (offset == block_capacity) {
+            spin_pause(round);
+            tail = tail_.index.load(std::memory_order_acquire);
+            block = tail_.block.load(std::memory_order_acquire);
+            continue;
+        }
+
+        // About to take the last slot: have the successor ready so the gap stays short
+        if (offset + 1 == block_capacity && next_block == nullptr) next_block = acquire_block();
+
+        std::size_t new_tail = tail + (std::size_t{1} << shift);
+        if (tail_.index.compare_exchange_weak(tail, new_tail, std::memory_order_seq_cst, std::memory_order_acquire)) {
+            if (offset + 1 == block_capacity) {
+                tail_.block.store(next_block, std::memory_order_release);
+                tail_.index.store(new_tail + (std::size_t{1} << shift), std::memory_order_release);
+                block->next.store(next_block, std::memory_order_release);
+                next_block = nullptr;
+            }
+
+            Slot &slot = block->slots[offset];
+            try {
+                ::new (&slot.storage) T(std::forward<Args>(args)...);
+            } catch (...) {
+                slot.state.fetch_or(written | poisoned, std::memory_order_release);  // Pops step over it
+                if (next_block) recycle(next_block);
+                throw;
+            }
+            slot.state.fetch_or(written, std::memory_order_release);
+
+            if (next_block) recycle(next_block);  // Prepared for a last slot another producer won
+            return true;
+        }
+        block = tail_.block.load(std::memory_order_acquire);
+    }
+}
+
+// Pop - Claim the head position unless it has caught up with the tail
+template <typename T>
+std::optional<T> SegmentedQueue<T>::try_pop() {
+    std::size_t head = head_.index.load(std::memory_order_acquire);
+    Block *block = head_.block.load(std::memory_order_acquire);
+
+    for (std::uint32_t round = 0;; round++) {
+        std::size_t offset = (head >> shift) % lap;
+
+        // The consumer of the last slot is moving head_ to the next block
+        if (offset == block_capacity) {
+            spin_pause(round);
+            head = head_.index.load(std::memory_order_acquire);
+            block = head_.block.load(std::memory_order_acquire);
+            continue;
+        }
+
+        std::size_t new_head = head + (std::size_t{1} << shift);
+        if ((new_head & has_next) == 0) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::size_t tail = tail_.index.load(std::memory_order_relaxed);
+
+            if ((head >> shift) == (tail >> shift)) return std::nullopt;
+
+            // Head and tail are in different blocks, so this one has a successor
+            if ((head >> shift) / lap != (tail >> shift) / lap) new_head |= has_next;
+        }
+
+        if (head_.index.compare_exchange_weak(head, new_head, std::memory_order_seq_cst, std::memory_order_acquire)) {
+            if (offset + 1 == block_capacity) {
+                Block *next = block->wait_next();
+                std::size_t next_index = (new_head & ~has_next) + (std::size_t{1} << shift);
+                if (next->next.load(std::memory_order_relaxed) != nullptr) next_index |= has_next;
+                head_.block.store(next, std::memory_order_release);
+                head_.index.store(next_index, std::memory_order_release);
+            }
+
+            Slot &slot = block->slots[offset];
+            slot.wait_written();
+            std::optional<T> value;
+            if ((slot.state.load(std::memory_order_relaxed) & poisoned) == 0) {
+                T *stored = slot.value();
+                value.emplace(std::move(*stored));
+                stored->~T();
+            }
+
+            if (offset + 1 == block_capacity) {
+                release_block(block, 0);
+            } else if (slot.state.fetch_or(read, std::memory_order_acq_rel) & destroy) {
+                release_block(block, offset + 1);
+            }
+            if (value) return value;
+
+            // Its constructor threw, so there is nothing to return; take the next position instead
+            head = head_.index.load(std::memory_order_acquire);
+            block = head_.block.load(std::memory_order_acquire);
+            continue;
+        }
+        block = head_.block.load(std::memory_order_acquire);
+    }
+}
+
+template <typename T>
+template <typename InputIt>
+std::size_t SegmentedQueue<T>::try_push_bulk(InputIt &first, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++, ++first) {
+        try {
+            try_emplace(*first);
+        } catch (...) {
+            if (i == 0) throw;
+            return i;  // Report what was stored; the next push meets the exception again
+        }
+    }
+    return n;
+}
+
+template <typename T>
+template <typename OutputIt>
+std::size_t SegmentedQueue<T>::try_pop_bulk(OutputIt &out, std::size_t n) {
+    std::size_t count = 0;
+    for (; count < n; count++, ++out) {
+        auto value = try_pop();
+        if (!value) break;
+        *out = std::move(*value);  // On a throw `value` destroys the element; try_pop() already freed its slot
+    }
+    return count;
+}
+
+template <typename T>
+bool SegmentedQueue<T>::empty() const {
+    std::size_t head = head_.index.load(std::memory_order_seq_cst);
+    std::size_t tail = tail_.index.load(std::memory_order_seq_cst);
+    return (head >> shift) == (tail >> shift);
+}
+
+// Element count - Positions between head and tail, minus the gaps at the end of each block
+template <typename T>
+std::size_t SegmentedQueue<T>::size() const {
+    while (true) {
+        std::size_t tail = tail_.index.load(std::memory_order_seq_cst);
+        std::size_t head = head_.index.load(std::memory_order_seq_cst);
+        if (tail_.index.load(std::memory_order_seq_cst) != tail) continue;  // Retry for a consistent pair
+
+        tail >>= shift;
+        head >>= shift;
+
+        // An index resting on a gap is about to move past it
+        if (tail % lap == lap - 1) tail++;
+        if (head % lap == lap - 1) head++;
+
+        // Rebase both onto the head's block so only whole gaps between them are counted
+        std::size_t base = head / lap * lap;
+        tail -= base;
+        head -= base;
+        return tail - head - tail / lap;
+    }
+}
+
+}  // namespace channel_detail
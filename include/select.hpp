@@ -1,13 +1,18 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
-#include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <optional>
-#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "channel.hpp"
@@ -18,20 +23,72 @@
  *
  * @details
  * Select<T> allows waiting on multiple channel operations (send/receive) and optionally a default case.
- * It integrates with Channel<T> through notifier registration to support blocking waits.
+ * Blocking waits are event driven: each case parks a waiter on its channel, the channel whose case
+ * becomes ready fires that waiter and reports the case index, and every waiter is removed again
+ * when the wait ends (wake-up, timeout or cancel). Nothing stays registered between calls.
  *
  * Behaviour:
- *  - At most one ready case is executed per run/run_blocking call.
- *  - If multiple cases are ready, one is chosen at random (no fairness guarantee).
+ *  - At most one ready case is executed per run/run_blocking call: readiness is probed without
+ *    side effects, and only the chosen case is then committed (probing again if it lost a race).
+ *  - If multiple cases are ready, the SelectPolicy decides which one runs: uniformly at random
+ *    (the default), the first in registration order (priority), or the next one after the
+ *    previously selected case (round-robin).
  *  - Default case runs immediately if no other case is ready.
  *  - run_blocking() blocks until any case is ready, cancelled, or timeout expires.
+ *  - awaitable() (C++20) suspends the calling coroutine instead: each case parks a waiter on its
+ *    channel, and the first channel whose case becomes ready posts the coroutine back to its
+ *    CoroScheduler.
  *
  * @tparam T The channel message type.
  */
 
+/**
+ * @brief How Select<T> picks among several ready cases.
+ */
+enum class SelectPolicy {
+    Random,      // Uniformly at random among the ready cases
+    Priority,    // Lowest registration index wins, e.g. control channels registered before bulk data
+    RoundRobin,  // First ready case after the one selected last, wrapping around
+};
+
+namespace channel_detail {
+
+// Small xorshift generator; four bytes of state and no syscalls, unlike std::random_device
+struct XorShift32 {
+    std::uint32_t state;
+
+    explicit XorShift32(std::uint32_t seed) : state(seed | 1u) {}
+
+    std::uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // Uniform enough in [0, bound) for picking cases; bound must be non-zero
+    std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(next()) * bound) >> 32);
+    }
+};
+
+// Per-thread generator, cheap enough to pick a starting case on every select
+inline std::uint32_t fast_random() {
+    thread_local XorShift32 rng(static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+    return rng.next();
+}
+
+}  // namespace channel_detail
+
 template <typename T>
 class Select {
    public:
+    /**
+     * @brief Creates an empty selector.
+     * @param policy How to choose when several cases are ready at once.
+     */
+    explicit Select(SelectPolicy policy = SelectPolicy::Random) : policy_(policy) {}
+
     /**
      * @brief Add a receive case to the selector.
      * @param chan The channel to receive from.
@@ -42,10 +99,15 @@ class Select {
     /**
      * @brief Add a send case to the selector.
      * @param chan The channel to send to.
-     * @param val The value to send.
+     * @param val The value to send. The rvalue overload moves it into the case.
      * @return Reference to the `Select` object for chaining.
+     *
+     * @note A value registered as an lvalue is kept, and each run that selects the case sends a
+     *       copy of it. A value registered as an rvalue is moved into the channel when the case
+     *       succeeds, so that case fires at most once per registration.
      */
     Select& send(Channel<T>& chan, const T& val);
+    Select& send(Channel<T>& chan, T&& val);
 
     /**
      * @brief Adds a default (fallback) case to the selector.
@@ -53,6 +115,12 @@ class Select {
      */
     Select& default_case();
 
+    /**
+     * @brief Changes how the selector chooses among several ready cases.
+     * @return Reference to the `Select` object for chaining.
+     */
+    Select& policy(SelectPolicy policy);
+
     /**
      * @brief Executes a non-blocking probe over all cases.
      *
@@ -68,8 +136,21 @@ class Select {
      */
     std::optional<size_t> run_blocking(std::chrono::milliseconds timeout = std::chrono::milliseconds::max());
 
+#if CHANNEL_HAS_COROUTINES
+    /**
+     * @brief Coroutine version of run_blocking(): `auto index = co_await select.awaitable();`
+     *
+     * Must be awaited from a coroutine running on a CoroScheduler, since channels resume the
+     * coroutine by posting it to that scheduler.
+     *
+     * @return Index of the selected case, or std::nullopt if cancelled.
+     * @throws logic_error from the co_await if the coroutine is not running on a CoroScheduler.
+     */
+    Task<std::optional<std::size_t>> awaitable();
+#endif
+
     /**
-     * @brief Cancels a blocking wait.
+     * @brief Cancels a blocking wait, including a suspended awaitable().
      */
     void cancel();
 
@@ -91,6 +172,13 @@ class Select {
      */
     std::optional<T> received_value() const;
 
+    /**
+     * @brief Moves the value received in a selected receive case out of the selector.
+     * Works for move-only types; a second call returns nullopt.
+     * @return Optional containing the received value, or nullopt if not applicable.
+     */
+    std::optional<T> take_received_value();
+
     /**
      * @brief Checks whether a specific case (by index) was successful.
      * @param index Index of the case to check.
@@ -108,16 +196,183 @@ class Select {
         std::optional<T> send_value;
         std::optional<T> recv_value;
         bool success = false;
+        bool consume = false;  // Registered from an rvalue: move send_value out instead of copying it
     };
 
     std::vector<Case> cases_;                    // List of registered cases
     std::optional<std::size_t> selected_index_;  // Index of selected case
     bool has_default_ = false;                   // Flag for default case
 
+    SelectPolicy policy_;                                            // Choice among ready cases
+    channel_detail::XorShift32 rng_{channel_detail::fast_random()};  // Used by SelectPolicy::Random
+    std::size_t next_turn_ = 0;                                      // Used by SelectPolicy::RoundRobin
+
     std::atomic<bool> cancelled_{false};  // Cancellation state
 
-    std::condition_variable cv_;  // Used for blocking wait
-    std::mutex cv_mtx_;           // Protects condition_variable access
+    // Wake-up state shared by the waiters parked on the channels; run_blocking() parks its thread on it
+    struct Sync : channel_detail::ParkedSelectSync {
+#if CHANNEL_HAS_COROUTINES
+        std::coroutine_handle<> handle;
+        CoroScheduler *scheduler = nullptr;
+#endif
+    };
+    Sync sync_;
+    std::vector<channel_detail::SelectWaiter> watchers_;  // One per case, reused across waits
+    std::size_t armed_count_ = 0;                         // Leading watchers_ currently parked
+    bool self_fired_ = false;                             // arm() found a case ready and claimed the wake-up itself
+
+    /**
+     * @brief Parks a waiter for every case on its channel. sync_.wake must be set.
+     * @return false if a case was already ready (or the select was cancelled), so there is
+     *         nothing to wait for; true if the caller should wait for sync_.wake.
+     */
+    bool arm();
+
+    /**
+     * @brief Removes the waiters parked by arm() that did not fire.
+     * @return What woke the select: a case index, SelectSync::cancelled, or SelectSync::armed if
+     *         nothing fired (timeout).
+     */
+    std::size_t disarm();
+
+    /**
+     * @brief Probes every case without side effects and picks one of the ready ones by policy_.
+     * @return Index of the chosen case, or cases_.size() if none is ready.
+     */
+    std::size_t pick_ready();
+
+    /**
+     * @brief Attempts only the case at `index`, recording it as selected on success.
+     */
+    bool try_case(std::size_t index);
+
+    /**
+     * @brief Tells the channel of case `woken` that its wake-up was used (CHANNEL_ENABLE_METRICS only).
+     */
+    void count_useful_wakeup(std::size_t woken);
+
+    /**
+     * @brief Clears the outcome of the previous run.
+     */
+    void clear_selection();
+
+#if CHANNEL_HAS_COROUTINES
+    struct WaitAwaitable;
+#endif
+};
+
+/**
+ * Heterogeneous select
+ *
+ * `select(cases...)` waits on channels of different element types at once and runs the handler
+ * of exactly one case:
+ *
+ *     select(recv(requests, [](Request&& r) { ... }),
+ *            recv(ticks, [](Tick&&) { ... }),
+ *            send(replies, reply, []() { ... }),
+ *            default_([]() { ... }));
+ *
+ *  - recv(ch, f): ready when ch has a value, which is moved into `f(T&&)`. If `f` accepts
+ *    std::optional<T> instead, the case also fires once ch is closed and drained, with nullopt.
+ *  - send(ch, value[, f]): ready when ch accepts the value without blocking; `f()` runs afterwards.
+ *  - default_([f]): makes the call non-blocking; runs when no other case is ready.
+ *
+ * Cases are checked starting from a random one so no channel is favoured. Without a default case
+ * the calling thread parks one waiter per case on its channel and sleeps until one of them fires.
+ * Nothing is allocated on the heap: the cases, waiters and wake-up state live on the caller's
+ * stack.
+ *
+ * @return Index (in argument order) of the case that ran.
+ */
+
+namespace channel_detail {
+
+// Handler used when a case is given none
+struct NoHandler {
+    template <typename... Args>
+    void operator()(Args &&...) const {}
 };
 
+template <typename T, typename F>
+struct RecvCase {
+    static constexpr bool is_default = false;
+    static constexpr bool observes_close = std::is_invocable_v<F &, std::optional<T>>;
+
+    Channel<T> *chan;
+    F handler;
+
+    bool try_fire();
+    void wakeup_used() { chan->select_wakeup_used(); }
+    bool watch(SelectWaiter *waiter) {
+        waiter->fire_on_close = observes_close;
+        return chan->watch_receive(waiter);
+    }
+    void unwatch(SelectWaiter *waiter) { chan->unwatch(waiter); }
+};
+
+template <typename T, typename F>
+struct SendCase {
+    static constexpr bool is_default = false;
+
+    Channel<T> *chan;
+    T value;
+    F handler;
+
+    bool try_fire();
+    void wakeup_used() { chan->select_wakeup_used(); }
+    bool watch(SelectWaiter *waiter) { return chan->watch_send(waiter); }
+    void unwatch(SelectWaiter *waiter) { chan->unwatch(waiter); }
+};
+
+template <typename F>
+struct DefaultCase {
+    static constexpr bool is_default = true;
+
+    F handler;
+
+    bool try_fire() { return false; }
+    void wakeup_used() {}
+    bool watch(SelectWaiter *) { return false; }
+    void unwatch(SelectWaiter *) {}
+};
+
+template <typename... Cases, std::size_t... I>
+std::size_t run_select(std::index_sequence<I...>, Cases &...cases);
+
+}  // namespace channel_detail
+
+/**
+ * @brief Receive case for select(). See above.
+ */
+template <typename T, typename F = channel_detail::NoHandler>
+channel_detail::RecvCase<T, std::decay_t<F>> recv(Channel<T> &chan, F &&handler = F{}) {
+    return {&chan, std::forward<F>(handler)};
+}
+
+/**
+ * @brief Send case for select(). The value is only moved into the channel if this case runs.
+ */
+template <typename T, typename U, typename F = channel_detail::NoHandler>
+channel_detail::SendCase<T, std::decay_t<F>> send(Channel<T> &chan, U &&value, F &&handler = F{}) {
+    return {&chan, T(std::forward<U>(value)), std::forward<F>(handler)};
+}
+
+/**
+ * @brief Default case for select(), making it non-blocking.
+ */
+template <typename F = channel_detail::NoHandler>
+channel_detail::DefaultCase<std::decay_t<F>> default_(F &&handler = F{}) {
+    return {std::forward<F>(handler)};
+}
+
+/**
+ * @brief Runs exactly one ready case out of `cases`, blocking unless a default_() case is given.
+ * @return Index of the case that ran.
+ */
+template <typename... Cases>
+std::size_t select(Cases &&...cases) {
+    static_assert(sizeof...(Cases) > 0, "select() needs at least one case");
+    return channel_detail::run_select(std::index_sequence_for<Cases...>{}, cases...);
+}
+
 #include "select.tpp"
\ No newline at end of file
@@ -3,14 +3,20 @@
 // Register a receive case
 template <typename T>
 Select<T>& Select<T>::receive(Channel<T>& chan) {
-    cases_.push_back(Case{CaseType::RECV, &chan, std::nullopt, std::nullopt, false});
+    cases_.push_back(Case{CaseType::RECV, &chan, std::nullopt, std::nullopt, false, false});
     return *this;
 }
 
 // Register a send case
 template <typename T>
 Select<T>& Select<T>::send(Channel<T>& chan, const T& val) {
-    cases_.push_back(Case{CaseType::SEND, &chan, val, std::nullopt, false});
+    cases_.push_back(Case{CaseType::SEND, &chan, val, std::nullopt, false, false});
+    return *this;
+}
+
+template <typename T>
+Select<T>& Select<T>::send(Channel<T>& chan, T&& val) {
+    cases_.push_back(Case{CaseType::SEND, &chan, std::move(val), std::nullopt, false, true});
     return *this;
 }
 
@@ -21,54 +27,26 @@ Select<T>& Select<T>::default_case() {
     return *this;
 }
 
-// Try to run any ready case (non-blocking)
+// Set the policy for choosing among ready cases
+template <typename T>
+Select<T>& Select<T>::policy(SelectPolicy policy) {
+    policy_ = policy;
+    return *this;
+}
+
+// Try to run any ready case (non-blocking) - Probe without side effects, then commit only the chosen case
 template <typename T>
 bool Select<T>::run() {
     if (is_cancelled()) return false;
 
-    // Clear previous selection state
-    selected_index_.reset();
-    for (auto& c : cases_) {
-        c.success = false;
-        c.recv_value.reset();
-    }
-
-    std::vector<std::size_t> ready_indices;
-
-    for (std::size_t i = 0; i < cases_.size(); i++) {
-        Case& c = cases_[i];
-        if (c.type == CaseType::RECV) {
-            // auto val = c.chan->try_receive();
-            if (c.chan->is_receive_ready()) {
-                // c.recv_value = val.value();
-                // c.success = true;
-                ready_indices.push_back(i);
-            }
-        } else if (c.type == CaseType::SEND) {
-            if (c.chan->try_send(*c.send_value)) {
-                c.success = true;
-                ready_indices.push_back(i);
-            }
-        }
-    }
+    clear_selection();
+    while (true) {
+        // Phase 1: readiness probe; nothing is sent or received here
+        std::size_t chosen = pick_ready();
+        if (chosen == cases_.size()) break;
 
-    if (!ready_indices.empty()) {
-        std::random_device rd;
-        std::mt19937 gen(rd());  // Mersenne Twister engine (a high-quality pseudo-random generator)
-        // Random selection on ready cases - Fairness on multiple ready cases
-        std::uniform_int_distribution<std::size_t> dist(0, ready_indices.size() - 1);
-        selected_index_ = ready_indices[dist(gen)];
-
-        Case& chosen = cases_[*selected_index_];
-        auto val = chosen.chan->try_receive();  // Should succeed due to earlier readiness check
-        if (val.has_value()) {
-            chosen.recv_value = *val;
-            chosen.success = true;
-            return true;
-        }
-        // Edge case: race condition where data is no longer available
-        selected_index_.reset();
-        return false;
+        // Phase 2: commit only the chosen case; if another thread got there first, probe again
+        if (try_case(chosen)) return true;
     }
 
     if (has_default_) {
@@ -79,48 +57,225 @@ bool Select<T>::run() {
     return false;
 }
 
-// Blocking run with optional timeout
+// Pick a ready case by policy - Single pass, nothing allocated
 template <typename T>
-std::optional<std::size_t> Select<T>::run_blocking(std::chrono::milliseconds timeout) {
-    auto deadline = std::chrono::steady_clock::now() + timeout;
+std::size_t Select<T>::pick_ready() {
+    std::size_t n = cases_.size();
+    auto ready = [this](std::size_t i) {
+        Case& c = cases_[i];
+        if (c.type == CaseType::RECV) return c.chan->is_receive_ready();
+        if (c.type == CaseType::SEND) return c.send_value && c.chan->is_send_ready();
+        return false;
+    };
 
-    // Register for wakeup notifications
+    if (policy_ == SelectPolicy::Random) {
+        // Reservoir sampling: the k-th ready case replaces the pick with probability 1/k
+        std::size_t chosen = n;
+        std::uint32_t seen = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            if (ready(i) && rng_.below(++seen) == 0) chosen = i;
+        }
+        return chosen;
+    }
+
+    // Priority scans from the first case, round-robin from the one after the last selection
+    std::size_t start = policy_ == SelectPolicy::RoundRobin && n > 0 ? next_turn_ % n : 0;
+    for (std::size_t k = 0; k < n; k++) {
+        std::size_t i = start + k < n ? start + k : start + k - n;
+        if (ready(i)) return i;
+    }
+    return n;
+}
+
+// Clear previous selection state
+template <typename T>
+void Select<T>::clear_selection() {
+    selected_index_.reset();
     for (auto& c : cases_) {
-        if (c.chan) {
-            c.chan->add_notifier(&cv_);
+        c.success = false;
+        c.recv_value.reset();
+    }
+}
+
+// Attempt a single case - Used for the case a channel reported as ready
+template <typename T>
+bool Select<T>::try_case(std::size_t index) {
+    clear_selection();
+    Case& c = cases_[index];
+    if (c.type == CaseType::RECV) {
+        c.recv_value = c.chan->try_receive();
+        c.success = c.recv_value.has_value();
+    } else if (c.type == CaseType::SEND && c.send_value) {
+        auto send_moved = [&c]() {
+            c.success = c.chan->try_send(std::move(*c.send_value));  // Only moved from on success
+            if (c.success) c.send_value.reset();
+        };
+        if constexpr (std::is_copy_constructible_v<T>) {
+            if (c.consume) {
+                send_moved();
+            } else {
+                c.success = c.chan->try_send(*c.send_value);  // Lvalue registration: a copy every run
+            }
+        } else {
+            send_moved();
         }
     }
+    if (c.success) {
+        selected_index_ = index;
+        next_turn_ = index + 1;
+    }
+    return c.success;
+}
 
+// Blocking run with optional timeout - Sleeps until a channel fires one of our waiters
+template <typename T>
+std::optional<std::size_t> Select<T>::run_blocking(std::chrono::milliseconds timeout) {
+    using Clock = std::chrono::steady_clock;
+    auto now = Clock::now();
+    bool forever = timeout >= std::chrono::duration_cast<std::chrono::milliseconds>(Clock::time_point::max() - now);
+    auto deadline = forever ? Clock::time_point::max() : now + timeout;
+
+    std::size_t woken = cases_.size();  // Case whose channel woke us, tried before a full run()
     while (true) {
         if (is_cancelled()) return std::nullopt;
 
-        if (run()) {
+        // Under SelectPolicy::Priority a higher case may be ready too, so let run() decide
+        bool take_woken = woken < cases_.size() && policy_ != SelectPolicy::Priority;
+        if ((take_woken && try_case(woken)) || run()) {
+            count_useful_wakeup(woken);
             return selected_index();
         }
 
-        if (std::chrono::steady_clock::now() >= deadline) {
+        if (!forever && Clock::now() >= deadline) {
             return std::nullopt;
         }
 
-        std::unique_lock lock(cv_mtx_);
-        // Wait for notification or timeout
-        cv_.wait_until(lock, deadline, [this]() {
-            return is_cancelled();
-        });
-        // After wakeup, loop to reevaluate case readiness
+        sync_.parker = &channel_detail::Parker::current();
+        sync_.done = false;
+        sync_.wake = &channel_detail::ParkedSelectSync::wake_parked;
+        bool wait = arm();
+        if (wait) {
+            if (forever) {
+                sync_.wait();
+            } else {
+                sync_.parker->park_until(sync_.done, deadline);
+            }
+        }
+        woken = disarm();
+
+        // Channels fire under their own lock, so disarm() already waited for them; a claim by
+        // cancel() is delivered without one, so let it land before sync_ is reused
+        if (wait && woken != channel_detail::SelectSync::armed) sync_.wait();
     }
 }
 
+// Park one waiter per case - Stops early if a case turns out to be ready already
+template <typename T>
+bool Select<T>::arm() {
+    watchers_.resize(cases_.size());
+    armed_count_ = 0;
+    self_fired_ = false;
+    sync_.fired.store(channel_detail::SelectSync::armed, std::memory_order_seq_cst);
+
+    // Pairs with cancel(): either it sees us armed and fires, or we see the flag
+    if (is_cancelled()) return !sync_.try_fire(channel_detail::SelectSync::cancelled);
+
+    for (std::size_t i = 0; i < cases_.size(); i++) {
+        Case& c = cases_[i];
+        channel_detail::SelectWaiter& w = watchers_[i];
+        w.sync = &sync_;
+        w.index = i;
+
+        bool ready = false;
+        if (c.type == CaseType::RECV) {
+            ready = c.chan->watch_receive(&w);
+        } else if (c.type == CaseType::SEND && c.send_value) {
+            ready = c.chan->watch_send(&w);
+        }
+        armed_count_ = i + 1;
+
+        // If the claim fails another channel fired first and will deliver the wake-up
+        if (ready) {
+            self_fired_ = sync_.try_fire(i);
+            return !self_fired_;
+        }
+    }
+    return true;
+}
+
+// Unpark the waiters that did not fire
+template <typename T>
+std::size_t Select<T>::disarm() {
+    for (std::size_t i = 0; i < armed_count_; i++) {
+        if (cases_[i].chan) cases_[i].chan->unwatch(&watchers_[i]);
+    }
+    armed_count_ = 0;
+    return sync_.fired.exchange(channel_detail::SelectSync::idle, std::memory_order_seq_cst);
+}
+
+// Credit the channel whose wake-up led straight to the selected case - Metrics only
+template <typename T>
+void Select<T>::count_useful_wakeup(std::size_t woken) {
+#if CHANNEL_ENABLE_METRICS
+    if (woken < cases_.size() && !self_fired_ && selected_index_ == woken) cases_[woken].chan->select_wakeup_used();
+#endif
+}
+
+#if CHANNEL_HAS_COROUTINES
+
+// Suspends the coroutine until one case fires or the select is cancelled
+template <typename T>
+struct Select<T>::WaitAwaitable {
+    Select& sel;
+
+    bool await_ready() { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        CoroScheduler* scheduler = CoroScheduler::current();
+        if (!scheduler) {
+            throw std::logic_error("Select::awaitable() must run on a CoroScheduler");
+        }
+
+        sel.sync_.handle = handle;
+        sel.sync_.scheduler = scheduler;
+        sel.sync_.wake = [](channel_detail::SelectSync* sync) {
+            auto* self = static_cast<Sync*>(sync);
+            self->scheduler->post(self->handle);  // Never resumed inline: the waker may hold a channel lock
+        };
+        return sel.arm();
+    }
+
+    std::size_t await_resume() { return sel.disarm(); }
+};
+
+// Coroutine select - Retry run() after every wake-up, since the fired case may have been taken by someone else
+template <typename T>
+Task<std::optional<std::size_t>> Select<T>::awaitable() {
+    std::size_t woken = cases_.size();
+    while (!is_cancelled()) {
+        bool take_woken = woken < cases_.size() && policy_ != SelectPolicy::Priority;
+        if ((take_woken && try_case(woken)) || run()) {
+            count_useful_wakeup(woken);
+            co_return selected_index();
+        }
+        woken = co_await WaitAwaitable{*this};
+    }
+    co_return std::nullopt;
+}
+
+#endif  // CHANNEL_HAS_COROUTINES
+
 // Trigger cancellation
 template <typename T>
 void Select<T>::cancel() {
-    cancelled_.store(true, std::memory_order_relaxed);
+    cancelled_.store(true, std::memory_order_seq_cst);
+    if (sync_.try_fire(channel_detail::SelectSync::cancelled)) sync_.wake(&sync_);
 }
 
 // Check if the select operation was cancelled
 template <typename T>
 bool Select<T>::is_cancelled() const {
-    return cancelled_.load(std::memory_order_relaxed);
+    return cancelled_.load(std::memory_order_seq_cst);
 }
 
 // Get the index of selected case
@@ -138,9 +293,118 @@ std::optional<T> Select<T>::received_value() const {
     return cases_[idx].recv_value;
 }
 
+// Move the received value out if applicable
+template <typename T>
+std::optional<T> Select<T>::take_received_value() {
+    if (!selected_index_ || *selected_index_ >= cases_.size())
+        return std::nullopt;
+    auto& c = cases_[*selected_index_];
+    std::optional<T> value = std::move(c.recv_value);
+    c.recv_value.reset();
+    return value;
+}
+
 // Check if a specific case was successful or not
 template <typename T>
 bool Select<T>::case_succeeded(std::size_t index) const {
     if (index >= cases_.size()) return false;
     return cases_[index].success;
 }
+
+namespace channel_detail {
+
+// Receive case - Closed-and-drained only counts as ready for handlers that take an optional
+template <typename T, typename F>
+bool RecvCase<T, F>::try_fire() {
+    std::optional<T> value = chan->try_receive();
+    if constexpr (observes_close) {
+        if (!value) {
+            if (!chan->is_closed()) return false;
+            value = chan->try_receive();  // A send may have landed just before close()
+        }
+        handler(std::move(value));
+        return true;
+    } else {
+        if (!value) return false;
+        handler(std::move(*value));
+        return true;
+    }
+}
+
+// Send case - try_send only moves the value out when it succeeds
+template <typename T, typename F>
+bool SendCase<T, F>::try_fire() {
+    if (!chan->try_send(std::move(value))) return false;
+    handler();
+    return true;
+}
+
+// Heterogeneous select loop - Probe, otherwise park one waiter per case and sleep until one fires
+template <typename... Cases, std::size_t... I>
+std::size_t run_select(std::index_sequence<I...>, Cases &...cases) {
+    constexpr std::size_t n = sizeof...(Cases);
+    constexpr std::size_t defaults = (std::size_t{Cases::is_default} + ...);
+    static_assert(defaults <= 1, "select() accepts at most one default case");
+
+    auto try_case = [&](std::size_t i) {
+        bool fired = false;
+        ((i == I && (fired = cases.try_fire())), ...);
+        return fired;
+    };
+
+    std::size_t start = fast_random() % n;
+    std::size_t woken = n;  // Case whose channel woke us, tried first
+    bool woken_by_channel = true;
+    auto selected = [&](std::size_t i) {
+#if CHANNEL_ENABLE_METRICS
+        if (i == woken && woken_by_channel) ((i == I ? cases.wakeup_used() : void()), ...);
+#endif
+        return i;
+    };
+    while (true) {
+        if (woken < n && try_case(woken)) return selected(woken);
+        for (std::size_t k = 0; k < n; k++) {
+            std::size_t i = (start + k) % n;
+            if (try_case(i)) return selected(i);
+        }
+
+        if constexpr (defaults > 0) {
+            std::size_t index = n;
+            auto run_default = [&index](std::size_t i, auto &c) {
+                if constexpr (std::decay_t<decltype(c)>::is_default) {
+                    c.handler();
+                    index = i;
+                }
+            };
+            (run_default(I, cases), ...);
+            return index;
+        } else {
+            ParkedSelectSync sync;
+            std::array<SelectWaiter, n> waiters;
+            sync.fired.store(SelectSync::armed, std::memory_order_seq_cst);
+
+            // Park a waiter per case; stop early if one is ready already
+            std::size_t armed = 0;
+            bool ready = false, self_fired = false;
+            auto arm = [&](std::size_t i, auto &c) {
+                if (ready) return;  // An earlier case is ready already
+                waiters[i].sync = &sync;
+                waiters[i].index = i;
+                armed = i + 1;
+                if (c.watch(&waiters[i])) {
+                    ready = true;
+                    self_fired = sync.try_fire(i);  // If this fails another channel's wake-up is coming
+                }
+            };
+            (arm(I, cases), ...);
+            if (!self_fired) sync.wait();
+
+            // Unpark the rest; a channel only fires under its own lock, so no wake-up is still in flight after this
+            ((I < armed ? cases.unwatch(&waiters[I]) : void()), ...);
+            woken = sync.fired.load(std::memory_order_acquire);
+            woken_by_channel = !self_fired;
+        }
+    }
+}
+
+}  // namespace channel_detail
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "wait_strategy.hpp"
+
+/**
+ * @file send_gate.hpp
+ * @brief Serializes close() against sends that push into a channel's buffer without its lock.
+ *
+ * @details
+ * A lock-free send checks that the channel is open and then pushes, so a close() landing in
+ * between would let the item arrive after a receiver had already seen "closed and drained".
+ * SendGate closes that window: each push runs inside admit(), which counts it as in flight and
+ * refuses it once the gate is closing, and close() waits for the pushes already admitted. The
+ * channel publishes its closed flag to receivers only after that, so a receiver that reads the
+ * flag before popping finds every accepted item.
+ *
+ * The closing bit and the in-flight count share one word, so admit() is a single RMW to enter
+ * and one to leave.
+ */
+
+namespace channel_detail {
+
+class SendGate {
+   public:
+    /**
+     * @brief Runs `push` unless the gate is closing; close() waits for it to return (or throw).
+     * @return false, without running `push`, if close() has started.
+     */
+    template <typename Push>
+    bool admit(Push &&push) {
+        if (state_.fetch_add(in_flight, std::memory_order_seq_cst) & closing) {
+            leave();
+            return false;
+        }
+
+        struct Leave {
+            SendGate *gate;
+            ~Leave() { gate->leave(); }
+        } leave_on_exit{this};
+        push();
+        return true;
+    }
+
+    /**
+     * @brief Refuses further pushes and returns once every admitted one has finished.
+     */
+    void close() {
+        state_.fetch_or(closing, std::memory_order_seq_cst);
+        for (std::uint32_t round = 0; state_.load(std::memory_order_acquire) != closing; round++) {
+            spin_pause(round);
+        }
+    }
+
+    bool is_closing() const { return state_.load(std::memory_order_acquire) & closing; }
+
+   private:
+    static constexpr std::size_t closing = 1;    // Low bit: close() has started
+    static constexpr std::size_t in_flight = 2;  // One admitted push
+
+    void leave() { state_.fetch_sub(in_flight, std::memory_order_release); }
+
+    std::atomic<std::size_t> state_{0};
+};
+
+}  // namespace channel_detail
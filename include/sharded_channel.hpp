@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mpmc_ring.hpp"
+#include "send_gate.hpp"
+#include "wait_queue.hpp"
+#include "wait_strategy.hpp"
+
+/**
+ * @file sharded_channel.hpp
+ * @brief Declaration of a buffered channel split into per-thread shards, with work stealing on receive.
+ *
+ * @details
+ * Every send and receive on a Channel<T> claims a position on the same ring, so with many producers
+ * and consumers the ring's head and tail lines bounce between every core involved. ShardedChannel<T>
+ * gives each thread a home shard (its own lock-free ring) instead:
+ *  - A sender always pushes to its home shard, so items from one sending thread are received in
+ *    the order they were sent, and a full shard blocks only the senders that live on it.
+ *  - A receiver pops from its home shard first and steals from the others, in turn, only when
+ *    that one is empty.
+ * With one shard per core and balanced traffic, producers and consumers mostly touch lines no
+ * other core writes, which is what lets throughput grow with the core count. In exchange there is
+ * no FIFO order between items sent by different threads.
+ *
+ * Threads are given home shards round-robin in the order they first use any sharded channel, so a
+ * channel with as many shards as there are producer (or consumer) threads spreads them evenly.
+ *
+ * The mutex and condition variables are only touched when a side has to sleep. close() works as
+ * on Channel<T>: further sends fail, and receivers drain every shard before they see std::nullopt.
+ *
+ * @note Thread-safe for any number of senders and receivers.
+ *
+ * @tparam T The type of messages passed through the channel.
+ */
+
+namespace channel_detail {
+
+// A small per-thread number, handed out in order of first use; threads map to shards by it
+inline std::size_t thread_ordinal() {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t ordinal = next.fetch_add(1, std::memory_order_relaxed);
+    return ordinal;
+}
+
+}  // namespace channel_detail
+
+template <typename T>
+class ShardedChannel {
+   public:
+    /**
+     * @brief Constructs a sharded channel.
+     * @param shard_capacity Number of items each shard can hold. Must be greater than 0.
+     * @param shards Number of shards; 0 means one per hardware thread.
+     * @param wait_strategy How blocking send/receive wait. Defaults to parking at once.
+     * @param resource Supplies the shards and their rings. Must outlive the channel.
+     * @throws invalid_argument if shard_capacity is 0.
+     */
+    explicit ShardedChannel(std::size_t shard_capacity, std::size_t shards = 0,
+                            WaitStrategy wait_strategy = WaitStrategy::block(),
+                            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    ~ShardedChannel();
+
+    ShardedChannel(const ShardedChannel &) = delete;
+    ShardedChannel &operator=(const ShardedChannel &) = delete;
+
+    /**
+     * @brief Blocking send to the calling thread's home shard. Waits while that shard is full.
+     * @param value The value to send. The rvalue overload moves it into the channel.
+     * @throws runtime_error if the channel is closed.
+     */
+    void send(const T &value);
+    void send(T &&value);
+
+    /**
+     * @brief Blocking send that constructs the value in place once the home shard has room.
+     * @throws runtime_error if the channel is closed.
+     */
+    template <typename... Args>
+    void emplace(Args &&...args);
+
+    /**
+     * @brief Blocking receive: the home shard first, then the others. Waits while every shard is empty.
+     * @return An optional value; std::nullopt if the channel is closed and every shard is empty.
+     */
+    std::optional<T> receive();
+
+    /**
+     * @brief Non-blocking send to the calling thread's home shard.
+     * @param value The value to send. The rvalue overload only moves from it on success.
+     * @return true if the value was accepted, false if the home shard is full or the channel is closed.
+     */
+    bool try_send(const T &value);
+    bool try_send(T &&value);
+
+    /**
+     * @brief Non-blocking receive: the home shard first, then the others.
+     * @return An optional value if any shard has one, otherwise std::nullopt.
+     */
+    std::optional<T> try_receive();
+
+    /**
+     * @brief Closes the channel. Further sends will fail; buffered items can still be received.
+     * @note Waits for sends already pushing into a shard, so no accepted item arrives after a
+     *       receiver has seen the channel closed and drained.
+     */
+    void close();
+
+    /**
+     * @brief Checks if the channel is closed.
+     */
+    bool is_closed() const;
+
+    /**
+     * @brief Checks if every shard is empty. Lock-free.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Number of items buffered across all shards. Lock-free.
+     */
+    std::size_t len() const;
+
+    /**
+     * @brief Total capacity: shard_count() * the capacity of one shard.
+     */
+    std::size_t cap() const { return shards_.size() * shard_capacity_; }
+
+    std::size_t shard_count() const { return shards_.size(); }
+
+    /**
+     * @brief The shard the calling thread sends to and receives from first.
+     */
+    std::size_t home_shard() const { return channel_detail::thread_ordinal() % shards_.size(); }
+
+   private:
+    // One ring with the senders parked on it; a whole number of cache lines so shards never share one
+    struct alignas(channel_detail::cache_line_size) Shard {
+        Shard(std::size_t capacity, std::pmr::memory_resource *resource) : ring(capacity, resource) {}
+
+        channel_detail::MpmcRing<T> ring;
+        channel_detail::SendGate gate;                // This shard's pushes in flight; close() waits for them
+        std::atomic<std::size_t> waiting_senders{0};  // Senders parked on cv_sender
+        std::condition_variable cv_sender;            // Notifies this shard's senders when it has room
+    };
+
+    template <typename... Args>
+    void send_impl(Args &&...args);
+
+    template <typename... Args>
+    bool try_send_impl(Args &&...args);
+
+    // Pops from the home shard, then steals; returns the shard it popped from through `from`
+    std::optional<T> pop_any(std::size_t &from);
+
+    void wake_receiver();
+    void wake_sender(Shard &shard);
+
+    // Read-only after construction
+    std::size_t shard_capacity_;
+    const WaitStrategy wait_strategy_;
+    std::pmr::memory_resource *const resource_;
+    std::pmr::vector<Shard *> shards_;
+
+    // Blocking support, only touched when a side has to sleep
+    alignas(channel_detail::cache_line_size) std::atomic<bool> closed_{false};
+    std::atomic<std::size_t> waiting_receivers_{0};
+    std::mutex mtx;
+    std::condition_variable cv_receiver_;  // Notifies receivers when any shard has data
+};
+
+#include "sharded_channel.tpp"
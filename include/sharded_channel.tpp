@@ -0,0 +1,211 @@
+#pragma once
+
+// Constructor - One shard per hardware thread unless told otherwise
+template <typename T>
+ShardedChannel<T>::ShardedChannel(std::size_t shard_capacity, std::size_t shards, WaitStrategy wait_strategy,
+                                  std::pmr::memory_resource *resource)
+    : shard_capacity_(shard_capacity), wait_strategy_(wait_strategy), resource_(resource), shards_(resource) {
+    if (shard_capacity == 0) {
+        throw std::invalid_argument("ShardedChannel shard capacity must be greater than 0");
+    }
+    if (shards == 0) shards = std::max(1u, std::thread::hardware_concurrency());
+
+    shards_.reserve(shards);
+    try {
+        for (std::size_t i = 0; i < shards; i++) {
+            shards_.push_back(channel_detail::new_record<Shard>(resource_, shard_capacity, resource_));
+        }
+    } catch (...) {
+        for (Shard *shard : shards_) channel_detail::delete_record(resource_, shard);
+        throw;
+    }
+}
+
+// Destructor - Each ring destroys whatever it still buffers
+template <typename T>
+ShardedChannel<T>::~ShardedChannel() {
+    for (Shard *shard : shards_) channel_detail::delete_record(resource_, shard);
+}
+
+// Wake a parked receiver - Pairs with the fence in receive()'s slow path
+template <typename T>
+void ShardedChannel<T>::wake_receiver() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_receivers_.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    cv_receiver_.notify_one();
+}
+
+// Wake a sender parked on `shard` - Pairs with the fence in send()'s slow path
+template <typename T>
+void ShardedChannel<T>::wake_sender(Shard &shard) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shard.waiting_senders.load(std::memory_order_relaxed) == 0) return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    shard.cv_sender.notify_one();
+}
+
+// Send a value to the calling thread's home shard - Blocking Send
+template <typename T>
+void ShardedChannel<T>::send(const T &value) {
+    send_impl(value);
+}
+
+template <typename T>
+void ShardedChannel<T>::send(T &&value) {
+    send_impl(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+void ShardedChannel<T>::emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...> && std::is_nothrow_move_constructible_v<T>) {
+        // A shard builds such a value before claiming a slot on every attempt; build it once instead
+        return send_impl(T(std::forward<Args>(args)...));
+    }
+    send_impl(std::forward<Args>(args)...);
+}
+
+// Shared blocking send - args are only consumed by the attempt that succeeds
+template <typename T>
+template <typename... Args>
+void ShardedChannel<T>::send_impl(Args &&...args) {
+    // Fast path: room in the home shard, no lock needed
+    Shard &shard = *shards_[home_shard()];
+    bool pushed = false;
+    if (!shard.gate.admit([&]() { pushed = shard.ring.try_emplace(std::forward<Args>(args)...); })) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+    if (pushed) {
+        wake_receiver();
+        return;
+    }
+
+    // Slow path: wait for the home shard only, so this thread's items stay in order
+    auto attempt = [&]() {
+        return !shard.gate.admit([&]() { pushed = shard.ring.try_emplace(std::forward<Args>(args)...); }) || pushed;
+    };
+    if (!channel_detail::spin_until(wait_strategy_, attempt)) {
+        std::unique_lock<std::mutex> lock(mtx);
+        shard.waiting_senders.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        shard.cv_sender.wait(lock, attempt);
+        shard.waiting_senders.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if (!pushed) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+    wake_receiver();
+}
+
+// Non-blocking Send
+template <typename T>
+bool ShardedChannel<T>::try_send(const T &value) {
+    return try_send_impl(value);
+}
+
+template <typename T>
+bool ShardedChannel<T>::try_send(T &&value) {
+    return try_send_impl(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool ShardedChannel<T>::try_send_impl(Args &&...args) {
+    Shard &shard = *shards_[home_shard()];
+    bool pushed = false;
+    shard.gate.admit([&]() { pushed = shard.ring.try_emplace(std::forward<Args>(args)...); });
+    if (!pushed) return false;  // Closed, or the home shard is full
+    wake_receiver();
+    return true;
+}
+
+// Pop - Home shard first, then steal from the others in turn
+template <typename T>
+std::optional<T> ShardedChannel<T>::pop_any(std::size_t &from) {
+    std::size_t count = shards_.size();
+    std::size_t home = home_shard();
+    for (std::size_t i = 0; i < count; i++) {
+        from = home + i < count ? home + i : home + i - count;
+        if (auto value = shards_[from]->ring.try_pop()) return value;
+    }
+    return std::nullopt;
+}
+
+// Non-blocking Receive
+template <typename T>
+std::optional<T> ShardedChannel<T>::try_receive() {
+    std::size_t from;
+    auto value = pop_any(from);
+    if (value) wake_sender(*shards_[from]);
+    return value;
+}
+
+// Blocking Receive
+template <typename T>
+std::optional<T> ShardedChannel<T>::receive() {
+    // Fast path: any shard has data
+    std::size_t from;
+    if (auto value = pop_any(from)) {
+        wake_sender(*shards_[from]);
+        return value;
+    }
+
+    // Slow path: spin if the strategy allows, then park until a sender publishes or the channel closes
+    std::optional<T> value;
+    auto attempt = [&]() {
+        bool closed = closed_.load(std::memory_order_acquire);  // Before popping: a close seen here follows every send
+        if (auto popped = pop_any(from)) value.emplace(std::move(*popped));
+        return value.has_value() || closed;
+    };
+    if (!channel_detail::spin_until(wait_strategy_, attempt)) {
+        std::unique_lock<std::mutex> lock(mtx);
+        waiting_receivers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        cv_receiver_.wait(lock, attempt);
+        waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if (value) wake_sender(*shards_[from]);
+    return value;  // std::nullopt: closed and drained
+}
+
+// Close the channel
+template <typename T>
+void ShardedChannel<T>::close() {
+    // Refuse pushes on every shard and let the ones under way land before receivers can see the close
+    for (Shard *shard : shards_) shard->gate.close();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (closed_.load(std::memory_order_relaxed)) return;  // Already closed
+
+    closed_.store(true, std::memory_order_release);
+    cv_receiver_.notify_all();
+    for (Shard *shard : shards_) shard->cv_sender.notify_all();
+}
+
+// Check closed state
+template <typename T>
+bool ShardedChannel<T>::is_closed() const {
+    return closed_.load(std::memory_order_acquire);
+}
+
+// Check emptiness
+template <typename T>
+bool ShardedChannel<T>::empty() const {
+    for (const Shard *shard : shards_) {
+        if (!shard->ring.empty()) return false;
+    }
+    return true;
+}
+
+// Buffered item count - Each ring's racy estimate is clamped to its capacity
+template <typename T>
+std::size_t ShardedChannel<T>::len() const {
+    std::size_t total = 0;
+    for (const Shard *shard : shards_) total += std::min(shard->ring.size(), shard_capacity_);
+    return total;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "mpmc_ring.hpp"
+#include "send_gate.hpp"
+
+/**
+ * @file spsc_channel.hpp
+ * @brief Declaration of a buffered channel specialised for exactly one sender and one receiver.
+ *
+ * @details
+ * SpscChannel<T> offers the same send/receive/try_send/try_receive/close surface as Channel<T>,
+ * so a pipeline stage with a single producer and a single consumer can swap it in directly.
+ *
+ * The storage is a wait-free ring in which each side owns one index and keeps a cached copy
+ * of the other side's index. try_send/try_receive only touch the shared index when the cached
+ * one says the ring looks full/empty. Each push runs inside a SendGate so close() cannot land
+ * between the sender's open check and its publish. The blocking send/receive add one fence to
+ * check whether the peer is parked; the mutex and condition variables are only used when a
+ * side actually has to sleep.
+ *
+ * @note Only one thread may send and only one thread may receive at a time. close(),
+ *       is_closed() and empty() may be called from any thread.
+ *
+ * @tparam T The type of messages passed through the channel.
+ */
+
+template <typename T>
+class SpscChannel {
+   public:
+    /**
+     * @brief Constructs an SPSC channel.
+     * @param capacity Number of items the channel can hold. Must be greater than 0.
+     * @throws invalid_argument if capacity is 0.
+     */
+    explicit SpscChannel(std::size_t capacity);
+
+    ~SpscChannel();
+
+    SpscChannel(const SpscChannel &) = delete;
+    SpscChannel &operator=(const SpscChannel &) = delete;
+
+    /**
+     * @brief Blocking send. Waits while the buffer is full.
+     * @param value The value to send.
+     * @throws runtime_error if the channel is closed.
+     */
+    void send(const T &value);
+    void send(T &&value);
+
+    /**
+     * @brief Blocking receive. Waits while the buffer is empty.
+     * @return An optional value; std::nullopt if channel is closed and empty.
+     */
+    std::optional<T> receive();
+
+    /**
+     * @brief Wait-free send.
+     * @param value The value to send. Left untouched if the send fails.
+     * @return true if the value was accepted, false if the channel is full or closed.
+     */
+    bool try_send(const T &value);
+    bool try_send(T &&value);
+
+    /**
+     * @brief Wait-free receive.
+     * @return An optional value if available, otherwise std::nullopt.
+     */
+    std::optional<T> try_receive();
+
+    /**
+     * @brief Closes the channel. Further sends will fail; buffered items can still be received.
+     */
+    void close();
+
+    /**
+     * @brief Checks if the channel is closed.
+     * @return true if closed, false otherwise.
+     */
+    bool is_closed() const;
+
+    /**
+     * @brief Checks if the channel is empty.
+     * @return true if no item is buffered.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Number of items the channel can hold.
+     */
+    std::size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Number of items buffered right now; same as Channel<T>::len().
+     */
+    std::size_t len() const;
+
+    /**
+     * @brief Same as capacity(), matching Channel<T>::cap().
+     */
+    std::size_t cap() const { return capacity_; }
+
+   private:
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    T *slot(std::size_t pos) { return std::launder(reinterpret_cast<T *>(&slots_[pos & mask_])); }
+
+    template <typename U>
+    bool push(U &&value);
+
+    template <typename U>
+    void blocking_send(U &&value);
+
+    void wake_receiver();
+    void wake_sender();
+
+    // Producer-owned line
+    alignas(channel_detail::cache_line_size) std::atomic<std::size_t> tail_{0};  // Next position to write
+    std::size_t head_cache_ = 0;                                                 // Producer's view of head_
+    channel_detail::SendGate send_gate_;                                         // Orders pushes against close()
+
+    // Consumer-owned line
+    alignas(channel_detail::cache_line_size) std::atomic<std::size_t> head_{0};  // Next position to read
+    std::size_t tail_cache_ = 0;                                                 // Consumer's view of tail_
+
+    // Read-only after construction
+    alignas(channel_detail::cache_line_size) std::unique_ptr<Storage[]> slots_;
+    std::size_t capacity_;  // Logical bound requested by the caller
+    std::size_t mask_;      // Physical slot count (power of two) minus one
+
+    // Blocking support, only touched when a side has to sleep
+    alignas(channel_detail::cache_line_size) std::atomic<bool> closed_{false};
+    std::atomic<bool> sender_parked_{false};
+    std::atomic<bool> receiver_parked_{false};
+    std::mutex mtx;
+    std::condition_variable cv_sender_;    // Notifies the sender when space is available
+    std::condition_variable cv_receiver_;  // Notifies the receiver when data is available
+};
+
+#include "spsc_channel.tpp"
@@ -0,0 +1,196 @@
+#pragma once
+
+// Constructor - Round the slot count up to a power of two so positions map with a mask
+template <typename T>
+SpscChannel<T>::SpscChannel(std::size_t capacity) : capacity_(capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("SpscChannel capacity must be greater than 0");
+    }
+
+    std::size_t slots = 1;
+    while (slots < capacity) slots <<= 1;
+    slots_.reset(new Storage[slots]);
+    mask_ = slots - 1;
+}
+
+// Destructor - Destroy whatever is still buffered
+template <typename T>
+SpscChannel<T>::~SpscChannel() {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t pos = head_.load(std::memory_order_relaxed); pos != tail; pos++) {
+        slot(pos)->~T();
+    }
+}
+
+// Wait-free push - Only reloads head_ when the cached copy says the ring is full
+template <typename T>
+template <typename U>
+bool SpscChannel<T>::push(U &&value) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity_) {
+        head_cache_ = head_.load(std::memory_order_acquire);
+        if (tail - head_cache_ == capacity_) return false;  // Buffer is full
+    }
+
+    new (slot(tail)) T(std::forward<U>(value));
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Wait-free receive - Only reloads tail_ when the cached copy says the ring is empty
+template <typename T>
+std::optional<T> SpscChannel<T>::try_receive() {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        if (head == tail_cache_) return std::nullopt;  // No data available
+    }
+
+    T *stored = slot(head);
+    std::optional<T> value(std::move(*stored));
+    stored->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+}
+
+// Non-blocking Send
+template <typename T>
+bool SpscChannel<T>::try_send(const T &value) {
+    bool pushed = false;
+    send_gate_.admit([&]() { pushed = push(value); });
+    return pushed;
+}
+
+template <typename T>
+bool SpscChannel<T>::try_send(T &&value) {
+    bool pushed = false;
+    send_gate_.admit([&]() { pushed = push(std::move(value)); });
+    return pushed;
+}
+
+// Blocking Send
+template <typename T>
+void SpscChannel<T>::send(const T &value) {
+    blocking_send(value);
+}
+
+template <typename T>
+void SpscChannel<T>::send(T &&value) {
+    blocking_send(std::move(value));
+}
+
+template <typename T>
+template <typename U>
+void SpscChannel<T>::blocking_send(U &&value) {
+    // Fast path: room in the ring
+    bool pushed = false;
+    if (!send_gate_.admit([&]() { pushed = push(std::forward<U>(value)); })) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+    if (pushed) {
+        wake_receiver();
+        return;
+    }
+
+    // Slow path: park until the receiver frees a slot or the channel closes
+    std::unique_lock<std::mutex> lock(mtx);
+    sender_parked_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    cv_sender_.wait(lock, [&]() {
+        // Only consumes value when the push succeeds
+        return !send_gate_.admit([&]() { pushed = push(std::forward<U>(value)); }) || pushed;
+    });
+    sender_parked_.store(false, std::memory_order_relaxed);
+
+    if (!pushed) {
+        throw std::runtime_error("Cannot send to a closed channel");
+    }
+
+    lock.unlock();
+    wake_receiver();
+}
+
+// Blocking Receive
+template <typename T>
+std::optional<T> SpscChannel<T>::receive() {
+    // Fast path: data in the ring
+    if (auto value = try_receive()) {
+        wake_sender();
+        return value;
+    }
+
+    // Slow path: park until the sender publishes an item or the channel closes
+    std::unique_lock<std::mutex> lock(mtx);
+    receiver_parked_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::optional<T> value;
+    cv_receiver_.wait(lock, [&]() {
+        bool closed = closed_.load(std::memory_order_acquire);  // Before popping: a close seen here follows every send
+        value = try_receive();
+        return value.has_value() || closed;
+    });
+    receiver_parked_.store(false, std::memory_order_relaxed);
+
+    if (!value) {
+        return std::nullopt;  // Closed and drained
+    }
+
+    lock.unlock();
+    wake_sender();
+    return value;
+}
+
+// Wake the receiver if it is parked - Pairs with the fence in receive()'s slow path
+template <typename T>
+void SpscChannel<T>::wake_receiver() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!receiver_parked_.load(std::memory_order_relaxed)) return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    cv_receiver_.notify_one();
+}
+
+// Wake the sender if it is parked - Pairs with the fence in send()'s slow path
+template <typename T>
+void SpscChannel<T>::wake_sender() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!sender_parked_.load(std::memory_order_relaxed)) return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    cv_sender_.notify_one();
+}
+
+// Close the channel
+template <typename T>
+void SpscChannel<T>::close() {
+    send_gate_.close();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (closed_.load(std::memory_order_relaxed)) return;  // Already closed
+
+    closed_.store(true, std::memory_order_release);
+    cv_receiver_.notify_all();
+    cv_sender_.notify_all();
+}
+
+// Check closed state
+template <typename T>
+bool SpscChannel<T>::is_closed() const {
+    return closed_.load(std::memory_order_acquire);
+}
+
+// Check emptiness
+template <typename T>
+bool SpscChannel<T>::empty() const {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+}
+
+// Buffered item count - Head first: a tail read later never trails it, so the difference cannot underflow
+template <typename T>
+std::size_t SpscChannel<T>::len() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return std::min(tail - head, capacity_);
+}
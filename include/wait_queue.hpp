@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+
+/**
+ * @file wait_queue.hpp
+ * @brief Intrusive FIFO of waiter records parked on a channel.
+ *
+ * @details
+ * Waiter records are owned by whoever parked them (a record from the channel's memory resource for
+ * async operations, see new_record()); the queue only links them through their `prev`/`next`
+ * members, so parking and unparking never allocate.
+ * Not thread-safe: callers hold the owning channel's mutex.
+ *
+ * @tparam Node Waiter record type with `Node *prev` and `Node *next` members.
+ *
+ * A blocking operation that has to wait parks a record that lives on its own stack and sleeps on
+ * its thread's Parker; the counterpart that completes the record wakes exactly that thread.
+ *
+ * SelectSync/SelectWaiter are the records a suspended select parks on each of its channels: one
+ * SelectWaiter per case, all pointing at the select's SelectSync. The first channel whose case
+ * becomes ready claims the SelectSync and wakes the select; the others find it claimed and just
+ * drop their waiter.
+ */
+
+namespace channel_detail {
+
+// Construct an async waiter record in memory from `resource`
+template <typename Record, typename... Args>
+Record *new_record(std::pmr::memory_resource *resource, Args &&...args) {
+    void *memory = resource->allocate(sizeof(Record), alignof(Record));
+    try {
+        return ::new (memory) Record(std::forward<Args>(args)...);
+    } catch (...) {
+        resource->deallocate(memory, sizeof(Record), alignof(Record));
+        throw;
+    }
+}
+
+// Destroy a record made by new_record() and hand its memory back
+template <typename Record>
+void delete_record(std::pmr::memory_resource *resource, Record *record) {
+    record->~Record();
+    resource->deallocate(record, sizeof(Record), alignof(Record));
+}
+
+template <typename Node>
+class WaitQueue {
+   public:
+    bool empty() const { return head_ == nullptr; }
+    std::size_t size() const { return size_; }
+    Node *front() const { return head_; }
+
+    // Append a waiter at the back
+    void push_back(Node *node) {
+        node->prev = tail_;
+        node->next = nullptr;
+        if (tail_) {
+            tail_->next = node;
+        } else {
+            head_ = node;
+        }
+        tail_ = node;
+        size_++;
+    }
+
+    // Whether `node` is linked on this queue (a detached node has no prev and is not the head)
+    bool contains(const Node *node) const { return node->prev != nullptr || head_ == node; }
+
+    // Detach and return the oldest waiter, or nullptr if empty
+    Node *pop_front() {
+        Node *node = head_;
+        if (node) remove(node);
+        return node;
+    }
+
+    // Detach a waiter from anywhere in the queue
+    void remove(Node *node) {
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head_ = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            tail_ = node->prev;
+        }
+        node->prev = node->next = nullptr;
+        size_--;
+    }
+
+   private:
+    Node *head_ = nullptr;
+    Node *tail_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// Per-thread sleep primitive for blocking operations whose waiter record sits on the caller's stack
+class Parker {
+   public:
+    // The calling thread's parker
+    static Parker &current() {
+        thread_local Parker parker;
+        return parker;
+    }
+
+    // Sleep until `done` is set by unpark()
+    void park(const std::atomic<bool> &done) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [&done]() { return done.load(std::memory_order_relaxed); });
+    }
+
+    // Sleep until `done` is set or `deadline` passes; returns whether `done` was set
+    template <typename Clock, typename Duration>
+    bool park_until(const std::atomic<bool> &done, const std::chrono::time_point<Clock, Duration> &deadline) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return cv_.wait_until(lock, deadline, [&done]() { return done.load(std::memory_order_relaxed); });
+    }
+
+    // Set `done` and wake the parked thread. `done` is only written under mtx_, so once the parked
+    // thread has seen it under the lock the waker has stopped touching the record it belongs to.
+    void unpark(std::atomic<bool> &done) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        done.store(true, std::memory_order_release);
+        cv_.notify_one();
+    }
+
+    // After spinning until `done` was seen without the lock: wait for the unpark() that set it to
+    // leave the parker, so the thread may return (and exit) safely
+    void settle() {
+        std::lock_guard<std::mutex> lock(mtx_);
+    }
+
+   private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+};
+
+// Wake-up state shared by every case of one suspended select
+struct SelectSync {
+    static constexpr std::size_t idle = static_cast<std::size_t>(-1);       // Not waiting
+    static constexpr std::size_t armed = static_cast<std::size_t>(-2);      // Waiting for any case
+    static constexpr std::size_t cancelled = static_cast<std::size_t>(-3);  // Woken by cancel()
+
+    std::atomic<std::size_t> fired{idle};     // Case index that woke the select, or one of the states above
+    void (*wake)(SelectSync *) = nullptr;     // Called once by the claimer; must not block or touch a channel
+
+    // Claim the wake-up for `index`; only the first claim after arming succeeds
+    bool try_fire(std::size_t index) {
+        std::size_t expected = armed;
+        return fired.compare_exchange_strong(expected, index, std::memory_order_acq_rel);
+    }
+};
+
+// SelectSync for a select that blocks its thread: the wake-up unparks the thread
+struct ParkedSelectSync : SelectSync {
+    Parker *parker = &Parker::current();
+    std::atomic<bool> done{false};  // Written under the parker's mutex
+
+    ParkedSelectSync() { wake = &wake_parked; }
+
+    static void wake_parked(SelectSync *sync) {
+        auto *self = static_cast<ParkedSelectSync *>(sync);
+        self->parker->unpark(self->done);
+    }
+
+    void wait() { parker->park(done); }
+};
+
+// One select case parked on a channel, fired when that case could proceed
+struct SelectWaiter {
+    SelectWaiter *prev = nullptr;
+    SelectWaiter *next = nullptr;
+    SelectSync *sync = nullptr;
+    std::size_t index = 0;       // Case index reported through SelectSync::fired
+    bool sending = false;        // Parked on the send side rather than the receive side
+    bool fire_on_close = false;  // Receive case that also wants to observe close()
+    bool queued = false;         // Still linked on the channel (guarded by the channel mutex)
+};
+
+}  // namespace channel_detail
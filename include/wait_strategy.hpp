@@ -0,0 +1,134 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/**
+ * @file wait_strategy.hpp
+ * @brief How a blocked channel operation waits: park at once, spin for a while first, or never park.
+ *
+ * @details
+ * Parking costs a futex sleep on the waiting side and a futex wake on the completing side, which
+ * dominates sub-microsecond handoffs between threads on dedicated cores. A Channel<T> built with
+ * spin_then_park() polls for its counterpart for a bounded number of rounds (pausing the core, and
+ * yielding once the first rounds are used up) before parking as usual. busy_spin() never parks and
+ * is only sensible for threads pinned to their own cores; it yields once every 1024 rounds so an
+ * oversubscribed machine still makes progress.
+ *
+ * Channel<T>::wait_stats() reports how many waits the spin phase resolved and how many still had
+ * to park, which is the number to watch when tuning spin_limit.
+ */
+
+struct WaitStrategy {
+    enum class Kind {
+        Block,         // Park immediately (the default)
+        SpinThenPark,  // Poll up to spin_limit rounds, then park
+        BusySpin,      // Poll until done; never park
+    };
+
+    Kind kind = Kind::Block;
+    std::uint32_t spin_limit = 0;  // Polling rounds before parking; only used by SpinThenPark
+
+    static constexpr WaitStrategy block() { return {Kind::Block, 0}; }
+    static constexpr WaitStrategy spin_then_park(std::uint32_t spin_limit = 2048) {
+        return {Kind::SpinThenPark, spin_limit};
+    }
+    static constexpr WaitStrategy busy_spin() { return {Kind::BusySpin, 0}; }
+};
+
+/**
+ * @brief Outcome counters of the spin phase of a channel's blocking waits.
+ */
+struct WaitStats {
+    std::uint64_t spin_successes = 0;  // Waits that completed while spinning
+    std::uint64_t spin_failures = 0;   // Waits that spun for the whole budget and then parked
+};
+
+namespace channel_detail {
+
+// Tell the core we are spinning, so a sibling hyperthread gets the pipeline
+inline void cpu_relax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+// Pause for the first rounds of a spin, then give the time slice away so an oversubscribed
+// machine can still run the thread we are waiting for
+inline void spin_pause(std::uint32_t round) {
+    constexpr std::uint32_t pause_rounds = 64;
+    if (round < pause_rounds) {
+        cpu_relax();
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+// Deadline check for spin loops that only reads the clock every 64th call
+template <typename Clock, typename Duration>
+class DeadlinePoll {
+   public:
+    explicit DeadlinePoll(const std::chrono::time_point<Clock, Duration> &deadline) : deadline_(deadline) {}
+
+    bool operator()() { return ++polls_ % 64 == 0 && Clock::now() >= deadline_; }
+
+   private:
+    std::chrono::time_point<Clock, Duration> deadline_;
+    std::uint32_t polls_ = 0;
+};
+
+/**
+ * @brief steady_clock deadline `timeout` from now, or nullopt if it is too far away to represent.
+ */
+template <typename Rep, typename Period>
+std::optional<std::chrono::steady_clock::time_point> deadline_after(const std::chrono::duration<Rep, Period> &timeout) {
+    using Clock = std::chrono::steady_clock;
+    auto now = Clock::now();
+    if (std::chrono::duration<double>(timeout) >= std::chrono::duration<double>(Clock::time_point::max() - now)) {
+        return std::nullopt;
+    }
+    return now + std::chrono::duration_cast<Clock::duration>(timeout);
+}
+
+/**
+ * @brief Polls `ready` as the strategy allows.
+ * @return true if `ready` returned true before the spin budget ran out (always, for BusySpin);
+ *         false if the caller should park. Block never polls.
+ */
+template <typename Ready>
+bool spin_until(const WaitStrategy &strategy, Ready &&ready) {
+    switch (strategy.kind) {
+        case WaitStrategy::Kind::Block:
+            return false;
+        case WaitStrategy::Kind::SpinThenPark:
+            for (std::uint32_t round = 0; round < strategy.spin_limit; round++) {
+                if (ready()) return true;
+                spin_pause(round);
+            }
+            return false;
+        case WaitStrategy::Kind::BusySpin:
+            // Yield only rarely: nearly free on a dedicated core, but it keeps two spinning threads
+            // sharing one core from starving each other for a whole time slice
+            for (std::uint32_t round = 1; !ready(); round++) {
+                if (round % 1024 == 0) {
+                    std::this_thread::yield();
+                } else {
+                    cpu_relax();
+                }
+            }
+            return true;
+    }
+    return false;
+}
+
+}  // namespace channel_detail
@@ -0,0 +1,232 @@
+// This is for testing that a channel backed by a memory resource stays off the global heap once warm
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../include/channel.hpp"
+
+using namespace std;
+
+// Every global allocation in the process bumps this counter
+static atomic<size_t> global_allocations{0};
+
+void* operator new(size_t size) {
+    global_allocations.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+
+void* operator new(size_t size, align_val_t align) {
+    global_allocations.fetch_add(1, memory_order_relaxed);
+    size_t alignment = static_cast<size_t>(align);
+    if (void* p = aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete(void* p, align_val_t) noexcept { free(p); }
+void operator delete(void* p, size_t, align_val_t) noexcept { free(p); }
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+// Runs `warm_up` once to let pools and thread-locals fill, then returns the allocations made by `steady`
+template <typename WarmUp, typename Steady>
+size_t allocations_after_warm_up(WarmUp&& warm_up, Steady&& steady) {
+    warm_up();
+    size_t before = global_allocations.load();
+    steady();
+    return global_allocations.load() - before;
+}
+
+void test_ring_is_allocated_up_front() {
+    log("Testing a buffered channel allocates its whole ring from its resource...");
+    pmr::monotonic_buffer_resource arena;
+    size_t before = global_allocations.load();
+    {
+        Channel<int> ch(1024, WaitStrategy::block(), &arena);
+        assert(ch.memory_resource() == &arena);
+        for (int round = 0; round < 4; round++) {
+            for (int i = 0; i < 1024; i++) assert(ch.try_send(i));
+            for (int i = 0; i < 1024; i++) assert(ch.try_receive() == i);
+        }
+    }
+    // Only the arena's own chunk came from the heap; filling and draining the ring added nothing
+    assert(global_allocations.load() - before <= 1);
+    log("Testing a buffered channel allocates its whole ring from its resource completed...");
+}
+
+// One sender thread and this thread exchange `rounds` values, twice: once to warm up, once measured
+size_t threaded_exchange_allocations(size_t capacity, pmr::memory_resource* resource, int rounds) {
+    Channel<int> ch(capacity, WaitStrategy::block(), resource);
+    atomic<bool> measuring{false};
+
+    thread sender([&]() {
+        for (int i = 0; i < rounds; i++) ch.send(i);
+        while (!measuring.load()) this_thread::yield();
+        for (int i = 0; i < rounds; i++) ch.send(i);
+    });
+
+    size_t allocations = allocations_after_warm_up(
+        [&]() {
+            for (int i = 0; i < rounds; i++) assert(ch.receive() == i);
+        },
+        [&]() {
+            measuring.store(true);
+            for (int i = 0; i < rounds; i++) {
+                if (i % 2) {
+                    assert(ch.receive() == i);
+                } else {
+                    assert(ch.receive_for(chrono::seconds(10)) == i);
+                }
+            }
+        });
+    sender.join();
+    return allocations;
+}
+
+void test_blocking_traffic_does_not_allocate() {
+    log("Testing steady blocking traffic does not allocate...");
+    pmr::synchronized_pool_resource pool;
+    assert(threaded_exchange_allocations(64, &pool, 20000) == 0);
+    assert(threaded_exchange_allocations(1, &pool, 5000) == 0);
+    assert(threaded_exchange_allocations(0, &pool, 5000) == 0);
+    log("Testing steady blocking traffic does not allocate completed...");
+}
+
+// async_receive/async_send pairs on one thread; each pair parks one record and makes two futures
+size_t async_allocations(pmr::memory_resource* resource, int pairs) {
+    Channel<int> ch(0, WaitStrategy::block(), resource);
+    auto run = [&]() {
+        for (int i = 0; i < pairs; i++) {
+            auto received = ch.async_receive();
+            auto sent = ch.async_send(i);
+            sent.get();
+            assert(received.get() == i);
+        }
+    };
+    return allocations_after_warm_up(run, run);
+}
+
+void test_async_records_come_from_the_resource() {
+    log("Testing async records and future states come from the channel's resource...");
+    // The default resource is the global heap, so the counter does see async traffic...
+    assert(async_allocations(pmr::get_default_resource(), 100) >= 100);
+
+    // ...and a pool recycles records and shared states once it holds enough of them
+    pmr::synchronized_pool_resource pool;
+    assert(async_allocations(&pool, 1000) == 0);
+
+    // Buffered: async_send completes against the ring, async_receive against the sender's value
+    Channel<int> buffered(4, WaitStrategy::block(), &pool);
+    auto run = [&]() {
+        for (int i = 0; i < 1000; i++) {
+            buffered.async_send(i).get();
+            assert(buffered.async_receive().get() == i);
+        }
+    };
+    assert(allocations_after_warm_up(run, run) == 0);
+    log("Testing async records and future states come from the channel's resource completed...");
+}
+
+void test_unbounded_channel_recycles_segments() {
+    log("Testing an unbounded channel recycles its segments...");
+    // A producer the consumer keeps up with (the depth stays around one block) only ever has a
+    // few blocks in flight; once their spares are cached, the tail never reaches the resource
+    Channel<int> ch(Channel<int>::unbounded);
+    atomic<bool> measuring{false};
+    constexpr int rounds = 50000;
+
+    auto send_steadily = [&ch]() {
+        for (int i = 0; i < rounds; i++) {
+            while (ch.len() > 32) this_thread::yield();
+            ch.send(i);
+        }
+    };
+    thread sender([&]() {
+        send_steadily();
+        while (!measuring.load()) this_thread::yield();
+        send_steadily();
+    });
+    size_t allocations = allocations_after_warm_up(
+        [&]() {
+            for (int i = 0; i < rounds; i++) assert(ch.receive() == i);
+        },
+        [&]() {
+            measuring.store(true);
+            for (int i = 0; i < rounds; i++) assert(ch.receive() == i);
+        });
+    sender.join();
+
+    assert(allocations == 0);
+
+    // Single-threaded, with at most one value queued
+    allocations = allocations_after_warm_up(
+        [&]() {
+            for (int i = 0; i < 1000; i++) {
+                ch.send(i);
+                assert(ch.receive() == i);
+            }
+        },
+        [&]() {
+            for (int i = 0; i < rounds; i++) {
+                ch.send(i);
+                assert(ch.receive() == i);
+            }
+        });
+    assert(allocations == 0);
+    log("Testing an unbounded channel recycles its segments completed...");
+}
+
+int main() {
+    test_ring_is_allocated_up_front();
+    cout << "----------------------------------" << endl;
+    test_blocking_traffic_does_not_allocate();
+    cout << "----------------------------------" << endl;
+    test_async_records_come_from_the_resource();
+    cout << "----------------------------------" << endl;
+    test_unbounded_channel_recycles_segments();
+
+    return 0;
+}
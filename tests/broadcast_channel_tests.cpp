@@ -0,0 +1,326 @@
+// This is for testing the broadcast (fan-out) channel
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/broadcast_channel.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+// Counts live instances and copies, to check an item is stored once and reclaimed
+struct Tracked {
+    static atomic<int> live;
+    static atomic<int> copies;
+    int value;
+
+    explicit Tracked(int v) : value(v) { live++; }
+    Tracked(const Tracked& other) : value(other.value) {
+        live++;
+        copies++;
+    }
+    Tracked(Tracked&& other) noexcept : value(other.value) { live++; }
+    ~Tracked() { live--; }
+};
+atomic<int> Tracked::live{0};
+atomic<int> Tracked::copies{0};
+
+void test_broadcast_every_subscriber_sees_every_item() {
+    log("Testing broadcast delivers every item to every subscriber...");
+    BroadcastChannel<int> ch(4);
+    auto a = ch.subscribe();
+    auto b = ch.subscribe();
+    assert(ch.subscriber_count() == 2);
+
+    ch.send(1);
+    ch.send(2);
+    assert(a.len() == 2 && b.len() == 2);
+
+    assert(a.receive().value() == 1);
+    assert(a.receive().value() == 2);
+    assert(!a.try_receive().has_value());
+    assert(b.receive().value() == 1);
+    assert(b.receive().value() == 2);
+    assert(b.len() == 0);
+    log("Testing broadcast delivers every item to every subscriber completed...");
+}
+
+void test_broadcast_late_subscriber() {
+    log("Testing broadcast late subscriber only sees later items...");
+    BroadcastChannel<int> ch(4);
+    ch.send(1);  // Nobody subscribed: dropped
+
+    auto early = ch.subscribe();
+    ch.send(2);
+    auto late = ch.subscribe();
+    ch.send(3);
+
+    assert(early.receive().value() == 2);
+    assert(early.receive().value() == 3);
+    assert(late.receive().value() == 3);
+    assert(!late.try_receive().has_value());
+    log("Testing broadcast late subscriber completed...");
+}
+
+void test_broadcast_stores_once_and_reclaims() {
+    log("Testing broadcast stores each item once and reclaims it after the last reader...");
+    {
+        BroadcastChannel<Tracked> ch(8);
+        auto a = ch.subscribe();
+        auto b = ch.subscribe();
+        auto c = ch.subscribe();
+
+        Tracked::copies = 0;
+        for (int i = 0; i < 5; ++i) ch.send(Tracked(i));
+        assert(Tracked::copies == 0);  // Moved into the ring, not copied per subscriber
+        assert(Tracked::live == 5);
+
+        for (int i = 0; i < 5; ++i) {
+            assert(a.receive()->value == i);
+            assert(b.receive()->value == i);
+        }
+        assert(Tracked::live == 5);  // c still has to read them
+
+        for (int i = 0; i < 5; ++i) assert(c.receive()->value == i);
+        assert(Tracked::live == 0);     // The last reader moved each item out and freed its slot
+        assert(Tracked::copies == 10);  // Only the subscribers before it copied
+    }
+    assert(Tracked::live == 0);
+    log("Testing broadcast stores once and reclaims completed...");
+}
+
+void test_broadcast_block_policy() {
+    log("Testing broadcast block policy waits for the slowest subscriber...");
+    BroadcastChannel<int> ch(2, BroadcastPolicy::Block);
+    auto fast = ch.subscribe();
+    auto slow = ch.subscribe();
+
+    assert(ch.try_send(1));
+    assert(ch.try_send(2));
+    assert(fast.receive().value() == 1);
+    assert(fast.receive().value() == 2);
+    assert(!ch.try_send(3));  // slow has not read 1 yet
+
+    thread sender([&ch]() { ch.send(3); });  // Blocks until slow catches up
+    this_thread::sleep_for(chrono::milliseconds(50));
+    assert(!fast.try_receive().has_value());
+
+    assert(slow.receive().value() == 1);
+    sender.join();
+    assert(fast.receive().value() == 3);
+
+    slow.unsubscribe();  // Leaving releases what slow had not read
+    assert(ch.subscriber_count() == 1);
+    assert(ch.try_send(4));
+    assert(fast.receive().value() == 4);
+    log("Testing broadcast block policy completed...");
+}
+
+void test_broadcast_drop_oldest_policy() {
+    log("Testing broadcast drop-oldest policy skips a slow subscriber ahead...");
+    BroadcastChannel<int> ch(3, BroadcastPolicy::DropOldest);
+    auto fast = ch.subscribe();
+    auto slow = ch.subscribe();
+
+    for (int i = 0; i < 7; ++i) {
+        assert(ch.try_send(i));  // Never blocks
+        assert(fast.receive().value() == i);
+    }
+
+    // Only the last three are retained
+    assert(slow.receive().value() == 4);
+    assert(slow.missed() == 4);
+    assert(slow.receive().value() == 5);
+    assert(slow.receive().value() == 6);
+    assert(fast.missed() == 0);
+    log("Testing broadcast drop-oldest policy completed...");
+}
+
+void test_broadcast_lagged_policy() {
+    log("Testing broadcast lagged policy reports skipped items...");
+    BroadcastChannel<int> ch(2, BroadcastPolicy::Lagged);
+    auto sub = ch.subscribe();
+
+    for (int i = 0; i < 5; ++i) ch.send(i);
+
+    try {
+        sub.receive();
+        assert(false && "Expected BroadcastLagged");
+    } catch (const BroadcastLagged& e) {
+        assert(e.skipped() == 3);
+        log(string("Caught expected exception: ") + e.what());
+    }
+
+    // Resumes from the oldest retained item
+    assert(sub.receive().value() == 3);
+    assert(sub.receive().value() == 4);
+    assert(sub.missed() == 3);
+    log("Testing broadcast lagged policy completed...");
+}
+
+void test_broadcast_close_semantics() {
+    log("Testing broadcast close semantics...");
+    BroadcastChannel<int> ch(4);
+    auto sub = ch.subscribe();
+    ch.send(7);
+    ch.close();
+
+    assert(ch.is_closed());
+    assert(!ch.try_send(8));
+    try {
+        ch.send(8);
+        assert(false && "Expected exception from send after close");
+    } catch (const runtime_error& e) {
+        log(string("Caught expected exception: ") + e.what());
+    }
+
+    assert(sub.receive().value() == 7);  // Unread items survive close
+    assert(!sub.receive().has_value());  // Then closed and drained
+
+    BroadcastChannel<int> idle(1);
+    auto waiting = idle.subscribe();
+    thread receiver([&waiting]() { assert(!waiting.receive().has_value()); });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    idle.close();
+    receiver.join();
+    log("Testing broadcast close semantics completed...");
+}
+
+void test_broadcast_concurrent_fan_out() {
+    log("Testing broadcast fan-out with concurrent producers and subscribers...");
+    constexpr int producers = 2;
+    constexpr int per_producer = 20000;
+    constexpr int subscribers = 4;
+    BroadcastChannel<int> ch(64);
+
+    vector<BroadcastChannel<int>::Subscriber> subs;
+    for (int i = 0; i < subscribers; ++i) subs.push_back(ch.subscribe());
+
+    vector<thread> readers;
+    vector<long long> sums(subscribers, 0);
+    for (int s = 0; s < subscribers; ++s) {
+        readers.emplace_back([&, s]() {
+            vector<int> last(producers, -1);
+            while (auto v = subs[s].receive()) {
+                int producer = *v / per_producer;
+                int seq = *v % per_producer;
+                assert(seq > last[producer]);  // Per-producer order is kept
+                last[producer] = seq;
+                sums[s] += *v;
+            }
+        });
+    }
+
+    vector<thread> writers;
+    for (int p = 0; p < producers; ++p) {
+        writers.emplace_back([&ch, p]() {
+            for (int i = 0; i < per_producer; ++i) ch.send(p * per_producer + i);
+        });
+    }
+    for (auto& t : writers) t.join();
+    ch.close();
+    for (auto& t : readers) t.join();
+
+    long long n = producers * per_producer;
+    for (long long sum : sums) assert(sum == n * (n - 1) / 2);  // Nothing lost or duplicated
+    log("Testing broadcast fan-out completed...");
+}
+
+void test_broadcast_concurrent_drop_oldest() {
+    log("Testing broadcast drop-oldest under concurrent overwrite...");
+    constexpr int total = 50000;
+    BroadcastChannel<Tracked> ch(8, BroadcastPolicy::DropOldest);
+    {
+        auto fast = ch.subscribe();
+        auto slow = ch.subscribe();
+
+        thread slow_reader([&slow]() {
+            int last = -1;
+            while (auto v = slow.receive()) {
+                assert(v->value > last);  // Skips ahead, never back
+                last = v->value;
+                if (v->value % 64 == 0) this_thread::yield();
+            }
+        });
+        thread fast_reader([&fast]() {
+            int last = -1;
+            while (auto v = fast.receive()) {
+                assert(v->value > last);
+                last = v->value;
+            }
+        });
+
+        for (int i = 0; i < total; ++i) ch.send(Tracked(i));
+        ch.close();
+        slow_reader.join();
+        fast_reader.join();
+
+        ostringstream oss;
+        oss << "slow subscriber missed " << slow.missed() << ", fast missed " << fast.missed();
+        log(oss.str());
+    }
+    assert(Tracked::live == 0);  // Unsubscribing released what was left in the ring
+    log("Testing broadcast drop-oldest under concurrent overwrite completed...");
+}
+
+int main() {
+    test_broadcast_every_subscriber_sees_every_item();
+    cout << "----------------------------------" << endl;
+    test_broadcast_late_subscriber();
+    cout << "----------------------------------" << endl;
+    test_broadcast_stores_once_and_reclaims();
+    cout << "----------------------------------" << endl;
+    test_broadcast_block_policy();
+    cout << "----------------------------------" << endl;
+    test_broadcast_drop_oldest_policy();
+    cout << "----------------------------------" << endl;
+    test_broadcast_lagged_policy();
+    cout << "----------------------------------" << endl;
+    test_broadcast_close_semantics();
+    cout << "----------------------------------" << endl;
+    test_broadcast_concurrent_fan_out();
+    cout << "----------------------------------" << endl;
+    test_broadcast_concurrent_drop_oldest();
+
+    return 0;
+}
@@ -1,15 +1,21 @@
 // This is for testing the channel class
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <future>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "../include/channel.hpp"
@@ -403,6 +409,1322 @@ void test_multi_producer_consumer_without_select() {
     log("Testing multiple producer consumer without select in single channel completed...");
 }
 
+void test_buffered_ring_stress() {
+    log("Testing buffered ring under contention...");
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 20000;
+
+    for (size_t capacity : {1, 3, 64}) {
+        Channel<int> ch(capacity);
+
+        vector<vector<int>> received(num_consumers);
+        vector<thread> producers;
+        for (int p = 0; p < num_producers; ++p) {
+            producers.emplace_back([p, &ch]() {
+                for (int i = 0; i < items_per_producer; ++i) {
+                    if (i % 2 == 0) {
+                        ch.send(p * items_per_producer + i);
+                    } else {
+                        while (!ch.try_send(p * items_per_producer + i)) this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        vector<thread> consumers;
+        for (int c = 0; c < num_consumers; ++c) {
+            consumers.emplace_back([c, &ch, &received]() {
+                while (auto v = ch.receive()) received[c].push_back(*v);
+            });
+        }
+
+        for (auto& t : producers) t.join();
+        ch.close();
+        for (auto& t : consumers) t.join();
+
+        set<int> uniq;
+        size_t total = 0;
+        for (auto& r : received) {
+            // Each consumer must see every producer's items in send order
+            vector<int> last(num_producers, -1);
+            for (int v : r) {
+                int p = v / items_per_producer;
+                assert(v > last[p]);
+                last[p] = v;
+            }
+            total += r.size();
+            uniq.insert(r.begin(), r.end());
+        }
+        assert(total == num_producers * items_per_producer);
+        assert(uniq.size() == total);
+        log("Capacity " + to_string(capacity) + ": received " + to_string(total) + " unique items");
+    }
+
+    log("Testing buffered ring under contention completed...");
+}
+
+void test_move_only_payloads() {
+    log("Testing move-only payloads through buffered and unbuffered channels...");
+
+    // Buffered: try_send leaves the argument untouched when the buffer is full
+    Channel<unique_ptr<int>> buffered(1);
+    auto first = make_unique<int>(1);
+    assert(buffered.try_send(std::move(first)));
+    assert(first == nullptr);
+
+    auto second = make_unique<int>(2);
+    assert(!buffered.try_send(std::move(second)));
+    assert(second != nullptr && *second == 2);
+
+    auto got = buffered.receive();
+    assert(got.has_value() && **got == 1);
+    buffered.send(std::move(second));
+    got = buffered.try_receive();
+    assert(got.has_value() && **got == 2);
+
+    // Unbuffered: the value is moved straight through to the receiver
+    Channel<unique_ptr<int>> unbuffered;
+    thread sender([&unbuffered]() { unbuffered.send(make_unique<int>(42)); });
+    auto v = unbuffered.receive();
+    assert(v.has_value() && **v == 42);
+    sender.join();
+
+    // async_send takes ownership of the value
+    auto fut_send = unbuffered.async_send(make_unique<int>(7));
+    auto r = unbuffered.receive();
+    fut_send.get();
+    assert(r.has_value() && **r == 7);
+
+    log("Testing move-only payloads completed...");
+}
+
+void test_emplace_constructs_in_place() {
+    log("Testing emplace...");
+    Channel<string> buffered(2);
+    buffered.emplace(3, 'x');
+    buffered.emplace("hello");
+    assert(buffered.receive().value() == "xxx");
+    assert(buffered.receive().value() == "hello");
+
+    Channel<pair<int, string>> unbuffered;
+    thread sender([&unbuffered]() { unbuffered.emplace(5, "five"); });
+    auto v = unbuffered.receive();
+    assert(v.has_value() && v->first == 5 && v->second == "five");
+    sender.join();
+
+    log("Testing emplace completed...");
+}
+
+void test_batch_send_receive() {
+    log("Testing batch send and receive...");
+    Channel<int> ch(4);
+
+    vector<int> items{1, 2, 3};
+    ch.send_batch(items.begin(), items.end());
+
+    vector<int> out;
+    assert(ch.try_receive_batch(back_inserter(out), 10) == 3);
+    assert((out == vector<int>{1, 2, 3}));
+    assert(ch.try_receive_batch(back_inserter(out), 10) == 0);
+
+    // A batch bigger than the buffer blocks until a receiver drains it
+    vector<int> big(100);
+    for (int i = 0; i < 100; ++i) big[i] = i;
+    thread sender([&]() {
+        ch.send_n(big.begin(), big.size());
+        ch.close();
+    });
+
+    vector<int> received;
+    int buf[8];
+    while (size_t n = ch.receive_batch(buf, 8)) {
+        assert(n <= 8);
+        received.insert(received.end(), buf, buf + n);
+    }
+    sender.join();
+    assert(received == big);
+    assert(ch.receive_batch(buf, 8) == 0);  // Closed and drained
+
+    // Unbuffered batches rendezvous element by element
+    Channel<string> unbuffered;
+    vector<string> words{"a", "b", "c"};
+    thread word_sender([&]() {
+        unbuffered.send_batch(make_move_iterator(words.begin()), make_move_iterator(words.end()));
+        unbuffered.close();
+    });
+    vector<string> got;
+    while (unbuffered.receive_batch(back_inserter(got), 2) > 0) {
+    }
+    word_sender.join();
+    assert((got == vector<string>{"a", "b", "c"}));
+
+    log("Testing batch send and receive completed...");
+}
+
+// Output iterator whose assignment throws once `fail_at` values were written
+struct FailingSink {
+    vector<int>* got;
+    size_t fail_at;
+
+    FailingSink& operator*() { return *this; }
+    FailingSink& operator++() { return *this; }
+    FailingSink& operator=(int value) {
+        if (got->size() == fail_at) throw runtime_error("sink full");
+        got->push_back(value);
+        return *this;
+    }
+};
+
+void test_batch_receive_throwing_output_frees_slots() {
+    log("Testing a throwing batch output frees its claimed slots...");
+    Channel<int> ch(4);
+    vector<int> items{1, 2, 3, 4};
+    ch.send_batch(items.begin(), items.end());
+
+    vector<int> got;
+    bool threw = false;
+    try {
+        ch.try_receive_batch(FailingSink{&got, 1}, 4);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+    assert(threw && (got == vector<int>{1}));
+    assert(ch.len() == 0);  // The rest of the claim was dropped
+
+    // Every slot is free again: a full round of sends still fits without blocking
+    for (int i = 5; i <= 8; i++) assert(ch.try_send(i));
+    vector<int> out;
+    assert(ch.try_receive_batch(back_inserter(out), 4) == 4);
+    assert((out == vector<int>{5, 6, 7, 8}));
+    log("Testing a throwing batch output frees its claimed slots completed...");
+}
+
+void test_unbounded_batch_receive_throwing_output() {
+    log("Testing a throwing batch output on unbounded and resizable channels...");
+    Channel<int> unbounded(Channel<int>::unbounded);
+    Channel<int> resizable(ResizableCapacity{4});
+    for (Channel<int>* ch : {&unbounded, &resizable}) {
+        vector<int> items{1, 2, 3, 4};
+        ch->send_batch(items.begin(), items.end());
+
+        vector<int> got;
+        bool threw = false;
+        try {
+            ch->try_receive_batch(FailingSink{&got, 1}, 4);
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+        assert(threw && (got == vector<int>{1}));
+        assert(ch->len() == 2);  // Only the element being written is lost; popped one at a time, the rest stay queued
+
+        // A resizable channel got back the reservations of both popped items
+        assert(ch->try_send(5) && ch->try_send(6));
+        vector<int> out;
+        assert(ch->try_receive_batch(back_inserter(out), 4) == 4);
+        assert((out == vector<int>{3, 4, 5, 6}));
+    }
+    log("Testing a throwing batch output on unbounded and resizable channels completed...");
+}
+
+void test_batch_stress() {
+    log("Testing batch send and receive under contention...");
+    constexpr int num_producers = 3;
+    constexpr int num_consumers = 3;
+    constexpr int items_per_producer = 30000;
+    Channel<int> ch(64);
+
+    vector<thread> producers;
+    for (int p = 0; p < num_producers; ++p) {
+        producers.emplace_back([p, &ch]() {
+            vector<int> chunk;
+            for (int i = 0; i < items_per_producer; ++i) {
+                chunk.push_back(p * items_per_producer + i);
+                if (chunk.size() == 50 || i == items_per_producer - 1) {
+                    ch.send_batch(chunk.begin(), chunk.end());
+                    chunk.clear();
+                }
+            }
+        });
+    }
+
+    vector<vector<int>> received(num_consumers);
+    vector<thread> consumers;
+    for (int c = 0; c < num_consumers; ++c) {
+        consumers.emplace_back([c, &ch, &received]() {
+            while (ch.receive_batch(back_inserter(received[c]), 32) > 0) {
+            }
+        });
+    }
+
+    for (auto& t : producers) t.join();
+    ch.close();
+    for (auto& t : consumers) t.join();
+
+    set<int> uniq;
+    size_t total = 0;
+    for (auto& r : received) {
+        total += r.size();
+        uniq.insert(r.begin(), r.end());
+    }
+    assert(total == num_producers * items_per_producer);
+    assert(uniq.size() == total);
+
+    log("Testing batch send and receive under contention completed...");
+}
+
+void test_many_pending_async_receives() {
+    log("Testing many pending async receives without a thread each...");
+    constexpr int pending = 100000;
+    Channel<int> ch;
+
+    vector<future<optional<int>>> futures;
+    futures.reserve(pending);
+    for (int i = 0; i < pending; ++i) futures.push_back(ch.async_receive());
+    assert(futures.front().wait_for(chrono::seconds(0)) == future_status::timeout);
+
+    // Each send is matched with the oldest parked receive, so no send blocks
+    for (int i = 0; i < pending; ++i) assert(ch.try_send(i));
+    for (int i = 0; i < pending; ++i) assert(futures[i].get().value() == i);
+
+    log("Testing many pending async receives completed...");
+}
+
+void test_async_send_parks_on_full_buffer() {
+    log("Testing async send parks on a full buffer...");
+    Channel<string> ch(1);
+    ch.send("first");
+
+    auto pending = ch.async_send(string("second"));
+    assert(pending.wait_for(chrono::milliseconds(50)) == future_status::timeout);
+
+    assert(ch.receive().value() == "first");  // Frees the slot, which completes the parked send
+    pending.get();
+    assert(ch.receive().value() == "second");
+
+    log("Testing async send parks on a full buffer completed...");
+}
+
+void test_close_completes_pending_async_operations() {
+    log("Testing close completes pending async operations...");
+    Channel<int> full(1);
+    full.send(1);
+    auto blocked_send = full.async_send(2);
+    full.close();
+    try {
+        blocked_send.get();
+        assert(false && "Expected exception from async_send pending at close");
+    } catch (const runtime_error& e) {
+        log(string("Caught expected exception: ") + e.what());
+    }
+    assert(full.receive().value() == 1);
+
+    Channel<int> empty;
+    auto blocked_receive = empty.async_receive();
+    empty.close();
+    assert(!blocked_receive.get().has_value());
+
+    log("Testing close completes pending async operations completed...");
+}
+
+void test_async_callbacks_run_on_executor() {
+    log("Testing async callbacks run on the channel's executor...");
+    ThreadPoolExecutor pool(2);
+    Channel<int> ch(4);
+    ch.set_executor(pool);
+
+    promise<optional<int>> received;
+    ch.async_receive([&received](optional<int> v) { received.set_value(v); });
+
+    promise<bool> sent;
+    ch.async_send(9, [&sent](bool ok) { sent.set_value(ok); });
+
+    assert(sent.get_future().get());
+    assert(received.get_future().get().value() == 9);
+
+    ch.close();
+    promise<bool> after_close;
+    ch.async_send(10, [&after_close](bool ok) { after_close.set_value(ok); });
+    assert(!after_close.get_future().get());
+
+    log("Testing async callbacks run on the channel's executor completed...");
+}
+
+void test_unbuffered_try_send_needs_parked_receiver() {
+    log("Testing unbuffered try_send succeeds only with a parked receiver...");
+    Channel<int> ch;
+    assert(!ch.try_send(1));  // Nobody is receiving
+
+    thread receiver([&]() { assert(ch.receive().value() == 2); });
+    while (!ch.try_send(2)) this_thread::yield();  // Succeeds once the receiver has parked
+    receiver.join();
+
+    assert(!ch.try_send(3));  // The only receiver is gone again
+    assert(!ch.try_receive().has_value());
+    log("Testing unbuffered try_send succeeds only with a parked receiver completed...");
+}
+
+void test_unbuffered_rendezvous_stress() {
+    log("Testing unbuffered rendezvous with many senders and receivers...");
+    constexpr int senders = 4, receivers = 4, per_sender = 5000;
+    Channel<int> ch;
+    mutex mtx;
+    vector<int> seen(senders * per_sender, 0);
+
+    vector<thread> threads;
+    for (int r = 0; r < receivers; ++r) {
+        threads.emplace_back([&]() {
+            while (auto v = ch.receive()) {
+                lock_guard lock(mtx);
+                seen[*v]++;
+            }
+        });
+    }
+    vector<thread> producers;
+    for (int s = 0; s < senders; ++s) {
+        producers.emplace_back([&, s]() {
+            for (int i = 0; i < per_sender; ++i) ch.send(s * per_sender + i);  // Returns once received
+        });
+    }
+    for (auto& t : producers) t.join();
+    ch.close();
+    for (auto& t : threads) t.join();
+
+    for (int count : seen) assert(count == 1);
+    log("Testing unbuffered rendezvous with many senders and receivers completed...");
+}
+
+void test_unbuffered_close_wakes_parked_sender() {
+    log("Testing close wakes a parked unbuffered sender...");
+    Channel<int> ch;
+    thread sender([&]() {
+        try {
+            ch.send(1);
+            assert(false && "Expected exception from send parked at close");
+        } catch (const runtime_error& e) {
+            log(string("Caught expected exception: ") + e.what());
+        }
+    });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    ch.close();
+    sender.join();
+    log("Testing close wakes a parked unbuffered sender completed...");
+}
+
+void test_wait_strategies_deliver_everything() {
+    log("Testing every wait strategy delivers all values in order...");
+    constexpr int count = 2000;
+    for (WaitStrategy strategy : {WaitStrategy::block(), WaitStrategy::spin_then_park(), WaitStrategy::busy_spin()}) {
+        for (size_t capacity : {0, 1, 64}) {
+            Channel<int> ch(capacity, strategy);
+            thread producer([&]() {
+                for (int i = 0; i < count; ++i) ch.send(i);
+                ch.close();
+            });
+            int expected = 0;
+            while (auto v = ch.receive()) assert(*v == expected++);
+            producer.join();
+            assert(expected == count);
+
+            WaitStats stats = ch.wait_stats();
+            if (strategy.kind == WaitStrategy::Kind::Block) {
+                assert(stats.spin_successes == 0 && stats.spin_failures == 0);
+            }
+            if (strategy.kind == WaitStrategy::Kind::BusySpin) {
+                assert(stats.spin_failures == 0);  // Never parks
+            }
+        }
+    }
+    log("Testing every wait strategy delivers all values in order completed...");
+}
+
+void test_spin_then_park_counts_outcomes() {
+    log("Testing spin-then-park counts spins that succeeded and spins that parked...");
+    // A receiver that waits much longer than the spin budget has to park
+    Channel<int> slow(1, WaitStrategy::spin_then_park(16));
+    thread sender([&]() {
+        this_thread::sleep_for(chrono::milliseconds(50));
+        slow.send(1);
+    });
+    assert(slow.receive() == 1);
+    sender.join();
+    assert(slow.wait_stats().spin_failures == 1);
+
+    // A generous budget lets a back-to-back handoff finish while spinning
+    Channel<int> fast(0, WaitStrategy::spin_then_park(1u << 20));
+    thread echo([&]() {
+        for (int i = 0; i < 1000; ++i) fast.send(i);
+    });
+    for (int i = 0; i < 1000; ++i) assert(fast.receive() == i);
+    echo.join();
+    WaitStats stats = fast.wait_stats();
+    log("spin successes " + to_string(stats.spin_successes) + ", failures " + to_string(stats.spin_failures));
+    assert(stats.spin_successes > 0);
+    log("Testing spin-then-park counts spins that succeeded and spins that parked completed...");
+}
+
+void test_close_releases_busy_spinning_waiters() {
+    log("Testing close releases busy-spinning receivers and senders...");
+    Channel<int> unbuffered(0, WaitStrategy::busy_spin());
+    Channel<int> full(1, WaitStrategy::busy_spin());
+    full.send(1);
+
+    thread receiver([&]() { assert(!unbuffered.receive().has_value()); });
+    thread sender([&]() {
+        try {
+            full.send(2);
+            assert(false && "Expected exception from send spinning at close");
+        } catch (const runtime_error&) {
+        }
+    });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    unbuffered.close();
+    full.close();
+    receiver.join();
+    sender.join();
+    assert(full.receive() == 1);
+    log("Testing close releases busy-spinning receivers and senders completed...");
+}
+
+void test_close_never_strands_accepted_sends() {
+    log("Testing every send accepted before close is received...");
+    for (int round = 0; round < 50; round++) {
+        Channel<int> ch(round % 2 == 0 ? 4 : Channel<int>::unbounded, WaitStrategy::spin_then_park());
+        atomic<int> sent{0};
+        atomic<int> received{0};
+
+        vector<thread> senders;
+        for (int s = 0; s < 3; s++) {
+            senders.emplace_back([&]() {
+                try {
+                    for (int i = 0;; i++) {
+                        if (i % 2 == 0) {
+                            ch.send(i);
+                        } else if (!ch.try_send(i)) {
+                            continue;
+                        }
+                        sent++;
+                    }
+                } catch (const runtime_error&) {
+                }
+            });
+        }
+        vector<thread> receivers;
+        for (int r = 0; r < 2; r++) {
+            receivers.emplace_back([&]() {
+                while (ch.receive()) received++;
+            });
+        }
+
+        this_thread::sleep_for(chrono::microseconds(200));
+        ch.close();
+        for (auto& t : senders) t.join();
+        for (auto& t : receivers) t.join();
+        assert(received == sent);
+        assert(!ch.try_receive());
+    }
+    log("Testing every send accepted before close is received completed...");
+}
+
+void test_len_cap_and_readiness() {
+    log("Testing len, cap and readiness queries...");
+    Channel<int> buffered(3);
+    assert(buffered.cap() == 3 && buffered.len() == 0);
+    assert(!buffered.is_receive_ready() && buffered.is_send_ready());
+    buffered.send(1);
+    buffered.send(2);
+    assert(buffered.len() == 2 && buffered.is_receive_ready());
+    buffered.send(3);
+    assert(buffered.len() == 3 && !buffered.is_send_ready());
+    buffered.close();
+    assert(buffered.is_closed() && !buffered.is_send_ready());
+    assert(buffered.is_receive_ready());  // Still draining
+
+    // Unbuffered: len/cap are always 0; readiness follows the parked counterparts
+    Channel<int> unbuffered;
+    assert(unbuffered.cap() == 0 && unbuffered.len() == 0);
+    assert(!unbuffered.is_receive_ready() && !unbuffered.is_send_ready() && unbuffered.empty());
+    thread sender([&]() { unbuffered.send(42); });
+    while (!unbuffered.is_receive_ready()) this_thread::yield();
+    assert(!unbuffered.empty() && unbuffered.len() == 0);
+    assert(unbuffered.receive() == 42);
+    sender.join();
+    assert(!unbuffered.is_receive_ready());
+
+    thread receiver([&]() { assert(unbuffered.receive() == 7); });
+    while (!unbuffered.is_send_ready()) this_thread::yield();
+    assert(unbuffered.try_send(7));
+    receiver.join();
+    assert(!unbuffered.is_send_ready());
+    log("Testing len, cap and readiness queries completed...");
+}
+
+void test_observers_during_traffic() {
+    log("Testing observers stay consistent during traffic...");
+    constexpr int count = 100000;
+    Channel<int> ch(16);
+    atomic<bool> done{false};
+    thread observer([&]() {
+        while (!done.load()) {
+            size_t n = ch.len();
+            assert(n <= ch.cap());
+            (void)ch.empty();
+            (void)ch.is_receive_ready();
+            (void)ch.is_send_ready();
+        }
+    });
+    thread producer([&]() {
+        for (int i = 0; i < count; ++i) ch.send(i);
+        ch.close();
+    });
+    int expected = 0;
+    while (auto v = ch.receive()) assert(*v == expected++);
+    producer.join();
+    done = true;
+    observer.join();
+    assert(expected == count && ch.len() == 0);
+    log("Testing observers stay consistent during traffic completed...");
+}
+
+void test_timed_buffered_operations() {
+    log("Testing timed send/receive on a buffered channel...");
+    Channel<unique_ptr<int>> ch(1);
+
+    auto start = chrono::steady_clock::now();
+    assert(!ch.receive_for(chrono::milliseconds(30)));  // Empty: times out
+    assert(chrono::steady_clock::now() - start >= chrono::milliseconds(30));
+
+    assert(ch.send_for(make_unique<int>(1), chrono::milliseconds(30)));
+    auto second = make_unique<int>(2);
+    assert(!ch.send_for(std::move(second), chrono::milliseconds(30)));  // Full: times out
+    assert(second && *second == 2);                                     // and leaves the value alone
+
+    // A receiver frees the slot while the sender waits
+    thread receiver([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        assert(**ch.receive() == 1);
+    });
+    assert(ch.send_until(std::move(second), chrono::system_clock::now() + chrono::seconds(5)));
+    assert(!second);
+    receiver.join();
+    assert(**ch.receive_for(chrono::seconds(5)) == 2);
+
+    // Close wakes a timed receiver, and timed sends on a closed channel throw
+    thread closer([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        ch.close();
+    });
+    assert(!ch.receive_for(chrono::seconds(5)));
+    closer.join();
+    try {
+        ch.send_for(make_unique<int>(3), chrono::milliseconds(10));
+        assert(false && "Expected exception from timed send on a closed channel");
+    } catch (const runtime_error&) {
+    }
+    log("Testing timed send/receive on a buffered channel completed...");
+}
+
+void test_timed_unbuffered_operations() {
+    log("Testing timed send/receive on an unbuffered channel...");
+    Channel<unique_ptr<int>> ch;
+
+    // A timed-out offer is withdrawn and the value handed back
+    auto value = make_unique<int>(5);
+    assert(!ch.send_for(std::move(value), chrono::milliseconds(30)));
+    assert(value && *value == 5);
+    assert(!ch.is_receive_ready() && !ch.try_receive());
+
+    // A timed-out receiver leaves nothing behind for try_send to hand a value to
+    assert(!ch.receive_for(chrono::milliseconds(30)));
+    assert(!ch.is_send_ready() && !ch.try_send(make_unique<int>(6)));
+
+    // Both succeed when the counterpart shows up in time
+    thread sender([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        ch.send(make_unique<int>(7));
+    });
+    assert(**ch.receive_until(chrono::steady_clock::now() + chrono::seconds(5)) == 7);
+    sender.join();
+
+    thread receiver([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        assert(**ch.receive() == 8);
+    });
+    assert(ch.send_for(make_unique<int>(8), chrono::seconds(5)));
+    receiver.join();
+
+    // Close fails a parked timed sender
+    thread closer([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        ch.close();
+    });
+    try {
+        ch.send_for(make_unique<int>(9), chrono::seconds(5));
+        assert(false && "Expected exception from timed send parked at close");
+    } catch (const runtime_error&) {
+    }
+    closer.join();
+    log("Testing timed send/receive on an unbuffered channel completed...");
+}
+
+void test_timed_operations_lose_nothing() {
+    log("Testing timed operations racing their deadlines lose no values...");
+    for (auto [capacity, strategy] : {pair{size_t{0}, WaitStrategy::block()}, pair{size_t{4}, WaitStrategy::block()},
+                                      pair{size_t{0}, WaitStrategy::spin_then_park(256)}}) {
+        constexpr int senders = 3, per_sender = 3000;
+        Channel<int> ch(capacity, strategy);
+        mutex mtx;
+        vector<int> seen(senders * per_sender, 0);
+        atomic<int> sent{0};
+
+        vector<thread> threads;
+        for (int s = 0; s < senders; ++s) {
+            threads.emplace_back([&, s]() {
+                for (int i = 0; i < per_sender; ++i) {
+                    int v = s * per_sender + i;
+                    while (!ch.send_for(v, chrono::microseconds(50))) {
+                    }  // Retry until a receiver takes it
+                    sent++;
+                }
+            });
+        }
+        thread receiver([&]() {
+            int received = 0;
+            while (received < senders * per_sender) {
+                if (auto v = ch.receive_for(chrono::microseconds(50))) {
+                    lock_guard lock(mtx);
+                    seen[*v]++;
+                    received++;
+                }
+            }
+        });
+        for (auto& t : threads) t.join();
+        receiver.join();
+
+        assert(sent == senders * per_sender);
+        for (int count : seen) assert(count == 1);
+        assert(!ch.try_receive());
+    }
+    log("Testing timed operations racing their deadlines lose no values completed...");
+}
+
+void test_channels_do_not_share_cache_lines() {
+    log("Testing cache-line layout of channels in an array...");
+    constexpr size_t line = channel_detail::cache_line_size;
+    static_assert(alignof(Channel<int>) >= line, "a channel must start on its own cache line");
+    static_assert(sizeof(Channel<int>) % line == 0, "a channel must fill whole cache lines");
+
+    vector<Channel<int>> chans(4);
+    for (auto& ch : chans) assert(reinterpret_cast<uintptr_t>(&ch) % line == 0);
+
+    // Neighbours stay independent under concurrent traffic
+    vector<thread> threads;
+    for (auto& ch : chans) {
+        threads.emplace_back([&ch]() {
+            for (int i = 0; i < 1000; i++) ch.send(i);
+            ch.close();
+        });
+        threads.emplace_back([&ch]() {
+            int expected = 0;
+            while (auto v = ch.receive()) assert(*v == expected++);
+            assert(expected == 1000);
+        });
+    }
+    for (auto& t : threads) t.join();
+    log("Testing cache-line layout of channels in an array completed...");
+}
+
+void test_unbounded_send_never_blocks() {
+    log("Testing unbounded channel sends never block...");
+    Channel<int> ch(Channel<int>::unbounded);
+    assert(ch.cap() == Channel<int>::unbounded);
+    assert(ch.empty() && ch.len() == 0 && ch.is_send_ready() && !ch.is_receive_ready());
+
+    // Far more than fit in one block, with no receiver running
+    constexpr int count = 100000;
+    for (int i = 0; i < count; i++) {
+        if (i % 3 == 0) {
+            assert(ch.try_send(i));
+        } else {
+            ch.send(i);
+        }
+    }
+    assert(ch.len() == count && ch.is_receive_ready() && ch.is_send_ready());
+    assert(ch.send_for(count, chrono::milliseconds(0)));
+
+    for (int i = 0; i <= count; i++) assert(ch.receive() == i);
+    assert(ch.empty() && ch.len() == 0);
+    assert(!ch.try_receive());
+
+    // Values left behind are destroyed with the channel
+    auto tracked = make_shared<int>(7);
+    {
+        Channel<shared_ptr<int>> leftovers(Channel<shared_ptr<int>>::unbounded);
+        for (int i = 0; i < 100; i++) leftovers.send(tracked);
+        assert(tracked.use_count() == 101);
+        leftovers.close();
+        assert(leftovers.receive() == tracked);
+    }
+    assert(tracked.use_count() == 1);
+    log("Testing unbounded channel sends never block completed...");
+}
+
+void test_unbounded_many_producers_and_consumers() {
+    log("Testing unbounded channel with many producers and consumers...");
+    Channel<pair<int, int>> ch(Channel<pair<int, int>>::unbounded);
+    constexpr int producers = 4, consumers = 4, per_producer = 20000;
+
+    // Receivers start first so they park and have to be woken
+    vector<vector<pair<int, int>>> received(consumers);
+    vector<thread> threads;
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c]() {
+            while (auto v = ch.receive()) received[c].push_back(*v);
+        });
+    }
+    vector<thread> senders;
+    for (int p = 0; p < producers; p++) {
+        senders.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; i++) ch.send({p, i});
+        });
+    }
+    for (auto& t : senders) t.join();
+    ch.close();
+    for (auto& t : threads) t.join();
+
+    // Everything arrives exactly once, and each consumer sees each producer's values in order
+    vector<vector<bool>> seen(producers, vector<bool>(per_producer, false));
+    size_t total = 0;
+    for (auto& values : received) {
+        vector<int> last(producers, -1);
+        for (auto [p, i] : values) {
+            assert(i > last[p]);
+            last[p] = i;
+            assert(!seen[p][i]);
+            seen[p][i] = true;
+            total++;
+        }
+    }
+    assert(total == static_cast<size_t>(producers * per_producer));
+    log("Testing unbounded channel with many producers and consumers completed...");
+}
+
+void test_high_water_mark() {
+    log("Testing the soft high-water mark callback...");
+    Channel<int> ch(Channel<int>::unbounded);
+    vector<size_t> reports;
+    ch.set_high_water_mark(100, [&](size_t depth) { reports.push_back(depth); });
+
+    for (int i = 0; i < 150; i++) ch.send(i);
+    assert(reports.size() == 1 && reports[0] == 100);  // Once on the way up, not on every send above
+
+    // Draining to just under the mark does not re-arm it...
+    for (int i = 0; i < 60; i++) ch.receive();
+    for (int i = 0; i < 20; i++) ch.send(i);
+    assert(reports.size() == 1);
+
+    // ...falling to half of it does
+    while (ch.len() > 40) ch.receive();
+    ch.send(0);  // The send that observes the low depth re-arms
+    while (ch.len() < 100) ch.send(0);
+    assert(reports.size() == 2 && reports[1] == 100);
+
+    // Removing the limit stops the callbacks
+    ch.set_high_water_mark(0, nullptr);
+    for (int i = 0; i < 200; i++) ch.send(i);
+    assert(reports.size() == 2);
+
+    // Bounded channels report too
+    Channel<int> bounded(8);
+    int fired = 0;
+    bounded.set_high_water_mark(6, [&](size_t depth) {
+        assert(depth >= 6);
+        fired++;
+    });
+    for (int i = 0; i < 8; i++) bounded.send(i);
+    assert(fired == 1);
+    log("Testing the soft high-water mark callback completed...");
+}
+
+void test_set_capacity() {
+    log("Testing set_capacity on a resizable channel...");
+    Channel<int> ch(ResizableCapacity{2});
+    assert(ch.cap() == 2);
+    ch.send(1);
+    ch.send(2);
+    assert(!ch.try_send(0) && !ch.is_send_ready());
+
+    // Growing releases a sender blocked for room
+    atomic<bool> sent{false};
+    thread sender([&]() {
+        ch.send(3);
+        sent = true;
+    });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    assert(!sent);
+    ch.set_capacity(4);
+    sender.join();
+    assert(ch.cap() == 4 && ch.len() == 3);
+
+    // ...and a parked async send
+    ch.send(4);
+    auto pending = ch.async_send(5);
+    assert(pending.wait_for(chrono::milliseconds(10)) == future_status::timeout);
+    ch.set_capacity(5);
+    pending.get();
+    assert(ch.len() == 5);
+
+    // Shrinking keeps what is buffered; sends wait until the depth falls under the new capacity
+    ch.set_capacity(2);
+    assert(ch.cap() == 2 && ch.len() == 5 && !ch.try_send(0));
+    for (int i = 1; i <= 3; i++) assert(ch.receive() == i);
+    assert(ch.len() == 2 && !ch.try_send(0));
+    assert(ch.receive() == 4);
+    assert(ch.try_send(6) && !ch.try_send(7));
+    assert(ch.receive() == 5 && ch.receive() == 6);
+
+    // Only resizable channels can be resized, and never to 0
+    bool threw = false;
+    try {
+        ch.set_capacity(0);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && ch.cap() == 2);
+
+    Channel<int> fixed(4);
+    threw = false;
+    try {
+        fixed.set_capacity(8);
+    } catch (const logic_error&) {
+        threw = true;
+    }
+    assert(threw && fixed.cap() == 4);
+
+    threw = false;
+    try {
+        Channel<int> empty(ResizableCapacity{0});
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    log("Testing set_capacity on a resizable channel completed...");
+}
+
+void test_resize_during_traffic() {
+    log("Testing resizing while producers and consumers run...");
+    Channel<int> ch(ResizableCapacity{4});
+    constexpr int producers = 3, per_producer = 20000;
+    atomic<bool> stop{false};
+
+    vector<thread> threads;
+    vector<int> counts(producers * per_producer, 0);
+    mutex counts_mtx;
+    for (int c = 0; c < 2; c++) {
+        threads.emplace_back([&]() {
+            vector<int> mine;
+            while (auto v = ch.receive()) mine.push_back(*v);
+            lock_guard<mutex> lock(counts_mtx);
+            for (int v : mine) counts[v]++;
+        });
+    }
+    vector<thread> senders;
+    for (int p = 0; p < producers; p++) {
+        senders.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; i++) ch.send(p * per_producer + i);
+        });
+    }
+    thread resizer([&]() {
+        for (size_t n = 1; !stop; n = n % 64 + 7) {
+            ch.set_capacity(n);
+            this_thread::yield();
+        }
+    });
+
+    for (auto& t : senders) t.join();
+    stop = true;
+    resizer.join();
+    ch.close();
+    for (auto& t : threads) t.join();
+    for (int c : counts) assert(c == 1);
+    log("Testing resizing while producers and consumers run completed...");
+}
+
+void test_capacity_auto_tuning() {
+    log("Testing capacity auto-tuning from blocked senders...");
+    CapacityTuning tuning;
+    tuning.min_capacity = 2;
+    tuning.max_capacity = 64;
+    tuning.grow_after = chrono::microseconds(1);
+    tuning.window = chrono::milliseconds(30);
+    Channel<int> ch(ResizableCapacity{2, tuning});
+
+    // A slow consumer keeps the sender blocked, so the capacity climbs to the maximum
+    thread consumer([&]() {
+        for (int i = 0; i < 400; i++) {
+            assert(ch.receive() == i);
+            this_thread::sleep_for(chrono::microseconds(50));
+        }
+    });
+    for (int i = 0; i < 400; i++) ch.send(i);
+    consumer.join();
+    assert(ch.cap() == 64);
+
+    // A receiver that keeps waiting while no sender blocks halves it, at most once per window
+    thread trickle([&]() {
+        for (int i = 0; i < 20; i++) {
+            this_thread::sleep_for(chrono::milliseconds(10));
+            ch.send(i);
+        }
+    });
+    for (int i = 0; i < 20; i++) assert(ch.receive() == i);
+    trickle.join();
+    assert(ch.cap() < 64 && ch.cap() >= 2);
+    log("Testing capacity auto-tuning from blocked senders completed...");
+}
+
+void test_overflow_drop_newest() {
+    log("Testing drop-newest overflow policy...");
+    Channel<int> ch(2, OverflowPolicy::DropNewest);
+    assert(ch.overflow_policy() == OverflowPolicy::DropNewest);
+
+    ch.send(1);
+    ch.send(2);
+    ch.send(3);  // Full: dropped, without waiting for a receiver
+    ch.emplace(4);
+    assert(ch.dropped() == 2 && ch.len() == 2);
+
+    // Operations that can report failure do so instead of dropping
+    assert(!ch.try_send(5) && !ch.send_for(5, chrono::seconds(10)));
+    assert(!ch.is_send_ready());
+    assert(ch.dropped() == 2);
+
+    auto pending = ch.async_send(6);  // Completes at once; the value is dropped
+    pending.get();
+    assert(ch.dropped() == 3);
+
+    assert(ch.receive() == 1 && ch.receive() == 2 && ch.empty());
+    log("Testing drop-newest overflow policy completed...");
+}
+
+void test_overflow_drop_oldest() {
+    log("Testing drop-oldest overflow policy...");
+    Channel<int> ch(3, OverflowPolicy::DropOldest);
+    for (int i = 0; i < 5; ++i) ch.send(i);
+    assert(ch.dropped() == 2 && ch.len() == 3);
+    assert(ch.is_send_ready());
+
+    assert(ch.try_send(5));  // Evicts 2
+    vector<int> batch = {6, 7};
+    ch.send_batch(batch.begin(), batch.end());  // Evicts 3 and 4
+    assert(ch.dropped() == 5);
+
+    assert(ch.receive() == 5 && ch.receive() == 6 && ch.receive() == 7 && ch.empty());
+
+    bool threw = false;
+    try {
+        Channel<int> unbuffered(0, OverflowPolicy::DropOldest);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    log("Testing drop-oldest overflow policy completed...");
+}
+
+void test_overflow_keep_latest() {
+    log("Testing keep-latest overflow policy...");
+    Channel<int> latest(1, OverflowPolicy::KeepLatest);
+    for (int i = 0; i < 100; ++i) latest.send(i);
+    assert(latest.len() == 1 && latest.dropped() == 99);
+    assert(latest.receive() == 99);
+    assert(!latest.try_receive().has_value());
+
+    // A fast producer never stalls on a slow reader, and the reader only ever moves forward
+    constexpr int total = 200000;
+    thread producer([&]() {
+        for (int i = 0; i < total; ++i) latest.send(i);
+        latest.close();
+    });
+    int last = -1;
+    while (auto v = latest.receive()) {
+        assert(*v > last);
+        last = *v;
+    }
+    producer.join();
+    assert(last == total - 1);  // The final value always survives
+
+    bool threw = false;
+    try {
+        Channel<int> wide(4, OverflowPolicy::KeepLatest);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    log("Testing keep-latest overflow policy completed...");
+}
+
+void test_range_for_drains_until_closed() {
+    log("Testing range-for iteration over a channel...");
+
+    // Buffered: everything buffered before close comes out in order, then the loop ends
+    Channel<int> buffered(1000);
+    for (int i = 0; i < 500; ++i) buffered.send(i);
+    buffered.close();
+    int expected = 0;
+    for (int v : buffered) assert(v == expected++);
+    assert(expected == 500);
+    assert(buffered.begin() == buffered.end());  // Closed and drained
+
+    // Move-only payloads can be moved out of the chunk
+    Channel<unique_ptr<int>> owners(8);
+    thread producer([&owners]() {
+        for (int i = 0; i < 100; ++i) owners.send(make_unique<int>(i));
+        owners.close();
+    });
+    int next = 0;
+    for (auto&& p : owners) {
+        unique_ptr<int> mine = std::move(p);
+        assert(*mine == next++);
+    }
+    producer.join();
+    assert(next == 100);
+
+    // Unbuffered: each item is a rendezvous, the loop still ends on close
+    Channel<string> unbuffered;
+    thread sender([&unbuffered]() {
+        unbuffered.send("a");
+        unbuffered.send("b");
+        unbuffered.close();
+    });
+    string joined;
+    for (const auto& word : unbuffered) joined += word;
+    sender.join();
+    assert(joined == "ab");
+
+    // Several consumers iterating together see every item exactly once
+    Channel<int> shared(64);
+    constexpr int total = 100000;
+    vector<vector<int>> seen(3);
+    vector<thread> consumers;
+    for (int c = 0; c < 3; ++c) {
+        consumers.emplace_back([&shared, &seen, c]() {
+            for (int v : shared) seen[c].push_back(v);
+        });
+    }
+    for (int i = 0; i < total; ++i) shared.send(i);
+    shared.close();
+    for (auto& t : consumers) t.join();
+    vector<int> counts(total, 0);
+    for (auto& s : seen) {
+        for (size_t i = 1; i < s.size(); ++i) assert(s[i] > s[i - 1]);  // Each consumer's share stays in order
+        for (int v : s) counts[v]++;
+    }
+    for (int c : counts) assert(c == 1);
+
+    log("Testing range-for iteration completed...");
+}
+
+// Constructing a negative one throws, and so does copying one that is poisoned
+struct Fragile {
+    int value;
+    bool poisoned = false;
+
+    explicit Fragile(int v) : value(v) {
+        if (v < 0) throw invalid_argument("negative Fragile");
+    }
+    Fragile(const Fragile& other) : value(other.value), poisoned(other.poisoned) {
+        if (poisoned) throw domain_error("poisoned Fragile copy");
+    }
+    Fragile(Fragile&&) noexcept = default;
+    Fragile& operator=(const Fragile&) = default;
+    Fragile& operator=(Fragile&&) noexcept = default;
+};
+
+void test_throwing_construction_keeps_ring_usable() {
+    log("Testing a throwing constructor leaves the ring usable...");
+    Channel<Fragile> ch(2);
+
+    bool threw = false;
+    try {
+        ch.emplace(-1);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && ch.len() == 0);
+
+    ch.emplace(1);
+    assert(ch.len() == 1);
+    auto value = ch.try_receive();
+    assert(value && value->value == 1);
+
+    // A throwing copy of an lvalue leaves the source and the ring alone
+    Fragile poisoned(2);
+    poisoned.poisoned = true;
+    threw = false;
+    try {
+        ch.send(poisoned);
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw && ch.len() == 0);
+    assert(poisoned.value == 2 && poisoned.poisoned);
+
+    // A bulk push stores the elements before the one whose copy throws, and receivers see them
+    vector<Fragile> items;
+    for (int i = 3; i <= 5; i++) items.emplace_back(i);
+    items[2].poisoned = true;
+    Channel<Fragile> batch(8);
+    threw = false;
+    try {
+        batch.send_batch(items.begin(), items.end());
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw && batch.len() == 2);
+    assert(batch.receive()->value == 3 && batch.receive()->value == 4);
+    assert(!batch.try_receive());
+
+    // A sender parked on the full ring still gets through once a receiver frees the slot
+    Channel<Fragile> one(1);
+    one.emplace(6);
+    thread sender([&]() { one.emplace(7); });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    assert(one.receive()->value == 6);
+    sender.join();
+    assert(one.receive()->value == 7);
+    log("Testing a throwing constructor leaves the ring usable completed...");
+}
+
+// Copy-only, so moving one may throw too; copying a poisoned one does
+struct CopyOnlyFragile {
+    int value;
+    bool poisoned = false;
+
+    explicit CopyOnlyFragile(int v) : value(v) {}
+    CopyOnlyFragile(const CopyOnlyFragile& other) : value(other.value), poisoned(other.poisoned) {
+        if (poisoned) throw domain_error("poisoned CopyOnlyFragile copy");
+    }
+    CopyOnlyFragile& operator=(const CopyOnlyFragile&) = default;
+};
+
+void test_throwing_copy_only_type_poisons_slot() {
+    log("Testing a throwing copy of a copy-only type poisons its slot...");
+    static_assert(!is_nothrow_move_constructible_v<CopyOnlyFragile>);
+    Channel<CopyOnlyFragile> ch(2);
+
+    CopyOnlyFragile poisoned(1);
+    poisoned.poisoned = true;
+    bool threw = false;
+    try {
+        ch.send(poisoned);
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Receivers step over the poisoned slot, and it is free again for the next lap
+    assert(!ch.try_receive());
+    for (int i = 2; i <= 5; i++) {
+        ch.send(CopyOnlyFragile(i));
+        assert(ch.receive()->value == i);
+    }
+
+    // A bulk push that throws part-way stores the elements before the failing one
+    vector<CopyOnlyFragile> items{CopyOnlyFragile(6), CopyOnlyFragile(7), CopyOnlyFragile(8)};
+    items[1].poisoned = true;
+    Channel<CopyOnlyFragile> batch(4);
+    threw = false;
+    try {
+        batch.send_batch(items.begin(), items.end());
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+    vector<CopyOnlyFragile> out;
+    assert(batch.try_receive_batch(back_inserter(out), 4) == 1 && out[0].value == 6);
+    batch.send(CopyOnlyFragile(9));
+    assert(batch.receive()->value == 9);
+    log("Testing a throwing copy of a copy-only type poisons its slot completed...");
+}
+
+template <typename F>
+void check_unbounded_survives_throwing_copies() {
+    Channel<F> ch(Channel<F>::unbounded);
+    F poisoned(0);
+    poisoned.poisoned = true;
+
+    // Enough rounds to cross several blocks, with a failed send between every two good ones
+    for (int i = 1; i <= 100; i++) {
+        ch.send(F(i));
+        bool threw = false;
+        try {
+            ch.send(poisoned);
+        } catch (const domain_error&) {
+            threw = true;
+        }
+        assert(threw);
+        auto value = ch.try_receive();
+        assert(value && value->value == i);
+    }
+    assert(!ch.try_receive());
+
+    // A bulk push stores the elements before the failing one
+    vector<F> items{F(1), F(2), F(3)};
+    items[1].poisoned = true;
+    bool threw = false;
+    try {
+        ch.send_batch(items.begin(), items.end());
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(ch.receive()->value == 1);
+    ch.close();
+    assert(!ch.receive());
+}
+
+void test_resizable_throwing_copy_keeps_capacity() {
+    log("Testing a throwing copy gives its reservation back to a resizable channel...");
+    Channel<CopyOnlyFragile> ch(ResizableCapacity{2});
+    CopyOnlyFragile poisoned(0);
+    poisoned.poisoned = true;
+
+    for (int i = 0; i < 5; i++) {
+        bool threw = false;
+        try {
+            ch.send(poisoned);
+        } catch (const domain_error&) {
+            threw = true;
+        }
+        assert(threw && ch.len() == 0);
+    }
+    assert(ch.try_send(CopyOnlyFragile(1)) && ch.try_send(CopyOnlyFragile(2)));
+    assert(!ch.try_send(CopyOnlyFragile(3)));
+    assert(ch.receive()->value == 1 && ch.receive()->value == 2);
+
+    // A bulk push that stops early gives back the room it claimed for the rest
+    ch.set_capacity(4);
+    vector<CopyOnlyFragile> items{CopyOnlyFragile(4), CopyOnlyFragile(5), CopyOnlyFragile(6)};
+    items[1].poisoned = true;
+    bool threw = false;
+    try {
+        ch.send_batch(items.begin(), items.end());
+    } catch (const domain_error&) {
+        threw = true;
+    }
+    assert(threw && ch.len() == 1);
+    for (int i = 7; i <= 9; i++) assert(ch.try_send(CopyOnlyFragile(i)));
+    assert(!ch.try_send(CopyOnlyFragile(10)));
+    log("Testing a throwing copy gives its reservation back to a resizable channel completed...");
+}
+
+void test_unbounded_throwing_copy_keeps_queue_usable() {
+    log("Testing a throwing copy leaves an unbounded channel usable...");
+    check_unbounded_survives_throwing_copies<Fragile>();          // Built before the claim
+    check_unbounded_survives_throwing_copies<CopyOnlyFragile>();  // Poisons its slot
+    log("Testing a throwing copy leaves an unbounded channel usable completed...");
+}
+
 int main() {
     testing_unbuffered_channel();
     cout << "----------------------------------" << endl;
@@ -423,6 +1745,82 @@ int main() {
     test_async_send_after_close_fails();
     cout << "----------------------------------" << endl;
     test_multi_producer_consumer_without_select();
+    cout << "----------------------------------" << endl;
+    test_buffered_ring_stress();
+    cout << "----------------------------------" << endl;
+    test_move_only_payloads();
+    cout << "----------------------------------" << endl;
+    test_emplace_constructs_in_place();
+    cout << "----------------------------------" << endl;
+    test_batch_send_receive();
+    cout << "----------------------------------" << endl;
+    test_batch_stress();
+    cout << "----------------------------------" << endl;
+    test_batch_receive_throwing_output_frees_slots();
+    cout << "----------------------------------" << endl;
+    test_unbounded_batch_receive_throwing_output();
+    cout << "----------------------------------" << endl;
+    test_many_pending_async_receives();
+    cout << "----------------------------------" << endl;
+    test_async_send_parks_on_full_buffer();
+    cout << "----------------------------------" << endl;
+    test_close_completes_pending_async_operations();
+    cout << "----------------------------------" << endl;
+    test_async_callbacks_run_on_executor();
+    cout << "----------------------------------" << endl;
+    test_unbuffered_try_send_needs_parked_receiver();
+    cout << "----------------------------------" << endl;
+    test_unbuffered_rendezvous_stress();
+    cout << "----------------------------------" << endl;
+    test_unbuffered_close_wakes_parked_sender();
+    cout << "----------------------------------" << endl;
+    test_wait_strategies_deliver_everything();
+    cout << "----------------------------------" << endl;
+    test_spin_then_park_counts_outcomes();
+    cout << "----------------------------------" << endl;
+    test_close_releases_busy_spinning_waiters();
+    cout << "----------------------------------" << endl;
+    test_close_never_strands_accepted_sends();
+    cout << "----------------------------------" << endl;
+    test_len_cap_and_readiness();
+    cout << "----------------------------------" << endl;
+    test_observers_during_traffic();
+    cout << "----------------------------------" << endl;
+    test_timed_buffered_operations();
+    cout << "----------------------------------" << endl;
+    test_timed_unbuffered_operations();
+    cout << "----------------------------------" << endl;
+    test_timed_operations_lose_nothing();
+    cout << "----------------------------------" << endl;
+    test_channels_do_not_share_cache_lines();
+    cout << "----------------------------------" << endl;
+    test_unbounded_send_never_blocks();
+    cout << "----------------------------------" << endl;
+    test_unbounded_many_producers_and_consumers();
+    cout << "----------------------------------" << endl;
+    test_high_water_mark();
+    cout << "----------------------------------" << endl;
+    test_set_capacity();
+    cout << "----------------------------------" << endl;
+    test_resize_during_traffic();
+    cout << "----------------------------------" << endl;
+    test_capacity_auto_tuning();
+    cout << "----------------------------------" << endl;
+    test_overflow_drop_newest();
+    cout << "----------------------------------" << endl;
+    test_overflow_drop_oldest();
+    cout << "----------------------------------" << endl;
+    test_overflow_keep_latest();
+    cout << "----------------------------------" << endl;
+    test_range_for_drains_until_closed();
+    cout << "----------------------------------" << endl;
+    test_throwing_construction_keeps_ring_usable();
+    cout << "----------------------------------" << endl;
+    test_throwing_copy_only_type_poisons_slot();
+    cout << "----------------------------------" << endl;
+    test_unbounded_throwing_copy_keeps_queue_usable();
+    cout << "----------------------------------" << endl;
+    test_resizable_throwing_copy_keeps_capacity();
 
     return 0;
 }
@@ -0,0 +1,292 @@
+// This is for testing the C++20 coroutine awaitables of Channel and Select
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/channel.hpp"
+#include "../include/select.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+#if CHANNEL_HAS_COROUTINES
+
+Task<void> ping(Channel<int>& to, Channel<int>& from, int rounds, int& last) {
+    for (int i = 0; i < rounds; ++i) {
+        co_await to.async_send_awaitable(i);
+        auto reply = co_await from.receive_awaitable();
+        assert(reply && *reply == i + 1);
+        last = *reply;
+    }
+    to.close();
+}
+
+Task<void> pong(Channel<int>& from, Channel<int>& to) {
+    while (auto v = co_await from.receive_awaitable()) {
+        co_await to.async_send_awaitable(*v + 1);
+    }
+}
+
+void test_coro_unbuffered_ping_pong() {
+    log("Testing coroutine ping-pong on an unbuffered channel...");
+    Channel<int> a, b;
+    int last = 0;
+
+    CoroScheduler scheduler;
+    scheduler.spawn(ping(a, b, 1000, last));
+    scheduler.spawn(pong(a, b));
+    scheduler.run();
+
+    assert(last == 1000);
+    log("Testing coroutine ping-pong on an unbuffered channel completed...");
+}
+
+Task<void> send_range(Channel<int>& ch, int first, int count) {
+    for (int i = first; i < first + count; ++i) co_await ch.async_send_awaitable(i);
+}
+
+Task<void> produce(Channel<int>& ch, int count) {
+    co_await send_range(ch, 0, count);
+    ch.close();
+}
+
+Task<void> consume(Channel<int>& ch, vector<int>& out) {
+    while (auto v = co_await ch.receive_awaitable()) out.push_back(*v);
+}
+
+void test_coro_buffered_order() {
+    log("Testing coroutine producer/consumer on a buffered channel...");
+    Channel<int> ch(4);
+    vector<int> out;
+
+    CoroScheduler scheduler;
+    scheduler.spawn(consume(ch, out));
+    scheduler.spawn(produce(ch, 500));
+    scheduler.run();
+
+    assert(out.size() == 500);
+    for (int i = 0; i < 500; ++i) assert(out[i] == i);
+    log("Testing coroutine producer/consumer on a buffered channel completed...");
+}
+
+Task<void> receive_one(Channel<int>& ch, thread::id& resumed_on, int& got) {
+    auto v = co_await ch.receive_awaitable();
+    resumed_on = this_thread::get_id();
+    got = v.value_or(-1);
+}
+
+void test_coro_resumed_on_scheduler_thread() {
+    log("Testing coroutine completed by another thread resumes on its scheduler...");
+    for (size_t cap : {0, 2}) {
+        Channel<int> ch(cap);
+        thread::id resumed_on;
+        int got = 0;
+
+        thread sender([&]() {
+            this_thread::sleep_for(chrono::milliseconds(20));
+            ch.send(42);
+        });
+
+        CoroScheduler scheduler;
+        scheduler.spawn(receive_one(ch, resumed_on, got));
+        scheduler.run();  // Sleeps until the sender posts the coroutine back
+        sender.join();
+
+        assert(got == 42);
+        assert(resumed_on == this_thread::get_id());
+    }
+    log("Testing coroutine completed by another thread resumes on its scheduler completed...");
+}
+
+Task<void> send_until_closed(Channel<int>& ch, bool& threw) {
+    try {
+        co_await ch.async_send_awaitable(1);
+        co_await ch.async_send_awaitable(2);  // Nobody receives; close() resumes us with an error
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+}
+
+Task<void> close_later(Channel<int>& ch) {
+    co_await ch.receive_awaitable();
+    ch.close();
+}
+
+void test_coro_close_resumes_sender() {
+    log("Testing close resumes a suspended coroutine sender...");
+    Channel<int> ch;
+    bool threw = false;
+
+    CoroScheduler scheduler;
+    scheduler.spawn(send_until_closed(ch, threw));
+    scheduler.spawn(close_later(ch));
+    scheduler.run();
+
+    assert(threw);
+    log("Testing close resumes a suspended coroutine sender completed...");
+}
+
+Task<void> select_loop(Select<int>& sel, vector<size_t>& picked, vector<int>& values, int expected) {
+    while (static_cast<int>(values.size()) < expected) {
+        auto index = co_await sel.awaitable();
+        if (!index) co_return;
+        picked.push_back(*index);
+        values.push_back(*sel.take_received_value());
+    }
+}
+
+void test_coro_select_awaitable() {
+    log("Testing co_await on a select over two channels...");
+    Channel<int> a, b(2);
+    Select<int> sel;
+    sel.receive(a).receive(b);
+
+    vector<size_t> picked;
+    vector<int> values;
+
+    CoroScheduler scheduler;
+    scheduler.spawn(select_loop(sel, picked, values, 20));
+    scheduler.spawn(send_range(a, 0, 10));
+    thread other([&]() {
+        for (int i = 100; i < 110; ++i) b.send(i);
+    });
+    scheduler.run();
+    other.join();
+
+    assert(values.size() == 20);
+    int from_a = 0, from_b = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (picked[i] == 0) {
+            assert(values[i] == from_a++);
+        } else {
+            assert(values[i] == 100 + from_b++);
+        }
+    }
+    assert(from_a == 10 && from_b == 10);
+    log("Testing co_await on a select over two channels completed...");
+}
+
+void test_coro_select_cancel() {
+    log("Testing cancel resumes a suspended select...");
+    Channel<int> ch;
+    Select<int> sel;
+    sel.receive(ch);
+
+    vector<size_t> picked;
+    vector<int> values;
+
+    CoroScheduler scheduler;
+    scheduler.spawn(select_loop(sel, picked, values, 1));
+    thread canceller([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        sel.cancel();
+    });
+    scheduler.run();
+    canceller.join();
+
+    assert(values.empty());
+    log("Testing cancel resumes a suspended select completed...");
+}
+
+Task<int> add_async(Channel<int>& ch) {
+    auto x = co_await ch.receive_awaitable();
+    auto y = co_await ch.receive_awaitable();
+    if (!x || !y) throw runtime_error("closed");
+    co_return *x + *y;
+}
+
+Task<void> await_tasks(Channel<int>& ch, int& sum, bool& threw) {
+    sum = co_await add_async(ch);
+    try {
+        co_await add_async(ch);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+}
+
+void test_coro_task_result_and_exception() {
+    log("Testing Task<T> results and exceptions...");
+    Channel<int> ch(4);
+    ch.send(2);
+    ch.send(3);
+    ch.send(4);
+    ch.close();
+
+    int sum = 0;
+    bool threw = false;
+    CoroScheduler scheduler;
+    scheduler.spawn(await_tasks(ch, sum, threw));
+    scheduler.run();
+
+    assert(sum == 5);
+    assert(threw);
+    log("Testing Task<T> results and exceptions completed...");
+}
+
+int main() {
+    test_coro_unbuffered_ping_pong();
+    cout << "----------------------------------" << endl;
+    test_coro_buffered_order();
+    cout << "----------------------------------" << endl;
+    test_coro_resumed_on_scheduler_thread();
+    cout << "----------------------------------" << endl;
+    test_coro_close_resumes_sender();
+    cout << "----------------------------------" << endl;
+    test_coro_select_awaitable();
+    cout << "----------------------------------" << endl;
+    test_coro_select_cancel();
+    cout << "----------------------------------" << endl;
+    test_coro_task_result_and_exception();
+
+    return 0;
+}
+
+#else
+
+int main() {
+    log("Coroutine tests skipped: compiler has no C++20 coroutine support");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,114 @@
+// This is for testing the executor used by async channel operations
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../include/executor.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+void test_executor_runs_every_task() {
+    log("Testing executor runs every task...");
+    atomic<int> ran{0};
+    {
+        ThreadPoolExecutor pool(3);
+        assert(pool.size() == 3);
+        for (int i = 0; i < 10000; ++i) pool.execute([&ran]() { ran.fetch_add(1); });
+    }  // Destructor drains the queues before joining
+    assert(ran.load() == 10000);
+    log("Testing executor runs every task completed...");
+}
+
+void test_executor_nested_submission() {
+    log("Testing tasks submitted from a worker...");
+    ThreadPoolExecutor pool(2);
+    promise<void> done;
+    atomic<int> depth{0};
+
+    function<void()> step;
+    step = [&]() {
+        if (depth.fetch_add(1) + 1 == 1000) {
+            done.set_value();
+            return;
+        }
+        pool.execute(step);
+    };
+    pool.execute(step);
+    done.get_future().get();
+    assert(depth.load() == 1000);
+    log("Testing tasks submitted from a worker completed...");
+}
+
+void test_executor_uses_bounded_threads() {
+    log("Testing executor runs on a bounded set of threads...");
+    ThreadPoolExecutor pool(2);
+    mutex mtx;
+    set<thread::id> ids;
+    atomic<int> remaining{500};
+    promise<void> done;
+
+    for (int i = 0; i < 500; ++i) {
+        pool.execute([&]() {
+            {
+                lock_guard lock(mtx);
+                ids.insert(this_thread::get_id());
+            }
+            if (remaining.fetch_sub(1) == 1) done.set_value();
+        });
+    }
+    done.get_future().get();
+    assert(ids.size() <= 2);
+    log("Threads used: " + to_string(ids.size()));
+    log("Testing executor runs on a bounded set of threads completed...");
+}
+
+int main() {
+    test_executor_runs_every_task();
+    cout << "----------------------------------" << endl;
+    test_executor_nested_submission();
+    cout << "----------------------------------" << endl;
+    test_executor_uses_bounded_threads();
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+// This is for testing the opt-in channel metrics; the build enables them for this file only
+
+#define CHANNEL_ENABLE_METRICS 1
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/channel.hpp"
+#include "../include/select.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+uint64_t histogram_total(const ChannelMetrics& m) {
+    return accumulate(m.wait_histogram.begin(), m.wait_histogram.end(), uint64_t{0});
+}
+
+void test_metrics_count_buffered_traffic() {
+    log("Testing metrics count buffered sends, receives and try_* failures...");
+    Channel<int> ch(4);
+    for (int i = 0; i < 4; ++i) ch.send(i);
+    assert(!ch.try_send(99));  // Full
+    int batch[] = {0, 0, 0};
+    assert(ch.receive_batch(batch, 3) == 3);
+    assert(ch.try_receive() == 3);
+    assert(!ch.try_receive());  // Empty
+    ch.async_send(5).get();
+    assert(ch.async_receive().get() == 5);
+
+    ChannelMetrics m = ch.metrics();
+    assert(m.sends == 5);
+    assert(m.receives == 5);
+    assert(m.try_send_failures == 1);
+    assert(m.try_receive_failures == 1);
+    assert(m.blocked_sends == 0 && m.blocked_receives == 0);
+    assert(m.high_water_mark == 4);
+    log("Testing metrics count buffered sends, receives and try_* failures completed...");
+}
+
+void test_metrics_time_blocked_operations() {
+    log("Testing metrics time blocked sends and receives...");
+    Channel<int> ch(1);
+    vector<ChannelWaitEvent> events;
+    mutex mtx;
+    ch.set_metrics_hook([&](const ChannelWaitEvent& e) {
+        lock_guard lock(mtx);
+        events.push_back(e);
+    });
+
+    // The receiver waits ~20ms for the first value, then the sender waits ~20ms for a free slot
+    thread receiver([&]() {
+        assert(ch.receive() == 1);
+        this_thread::sleep_for(chrono::milliseconds(20));
+        assert(ch.receive() == 2);
+        assert(ch.receive() == 3);
+    });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    ch.send(1);
+    ch.send(2);
+    ch.send(3);  // Blocks until the receiver wakes up again
+    receiver.join();
+
+    ChannelMetrics m = ch.metrics();
+    assert(m.blocked_receives >= 1);
+    assert(m.blocked_sends >= 1);
+    assert(m.receive_wait_ns >= 10'000'000);
+    assert(m.send_wait_ns >= 10'000'000);
+    assert(histogram_total(m) == m.blocked_sends + m.blocked_receives);
+    assert(events.size() == m.blocked_sends + m.blocked_receives);
+    log("Testing metrics time blocked sends and receives completed...");
+}
+
+void test_metrics_count_unbuffered_handoffs() {
+    log("Testing metrics count unbuffered handoffs...");
+    constexpr int count = 1000;
+    Channel<int> ch;
+    thread producer([&]() {
+        for (int i = 0; i < count; ++i) ch.send(i);
+    });
+    for (int i = 0; i < count; ++i) assert(ch.receive() == i);
+    producer.join();
+    assert(!ch.try_send(1));  // No receiver parked
+
+    ChannelMetrics m = ch.metrics();
+    assert(m.sends == count && m.receives == count);
+    assert(m.try_send_failures == 1);
+    assert(m.blocked_sends + m.blocked_receives == count);  // Exactly one side of every rendezvous parked
+    assert(m.high_water_mark == 0);
+    log("Testing metrics count unbuffered handoffs completed...");
+}
+
+void test_metrics_histogram_buckets() {
+    log("Testing metrics histogram bucket boundaries...");
+    assert(ChannelMetrics::bucket_for(0) == 0);
+    assert(ChannelMetrics::bucket_for(511) == 0);
+    assert(ChannelMetrics::bucket_for(512) == 1);
+    assert(ChannelMetrics::bucket_for(1023) == 1);
+    assert(ChannelMetrics::bucket_for(1024) == 2);
+    assert(ChannelMetrics::bucket_for(~uint64_t{0}) == ChannelMetrics::wait_buckets - 1);
+    log("Testing metrics histogram bucket boundaries completed...");
+}
+
+void test_metrics_select_wakeups() {
+    log("Testing metrics count select wake-ups and useful wake-ups...");
+    Channel<int> a(1), b(1);
+    Select<int> sel;
+    sel.receive(a).receive(b);
+
+    thread sender([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        b.send(7);
+    });
+    auto idx = sel.run_blocking(chrono::seconds(5));
+    sender.join();
+    assert(idx == 1u);
+
+    assert(a.metrics().select_wakeups == 0);
+    assert(b.metrics().select_wakeups == 1);
+    assert(b.metrics().select_useful_wakeups == 1);
+
+    // A select that never parks leaves the counters alone
+    Channel<int> c(1);
+    Select<int> lone;
+    lone.receive(c).default_case();
+    assert(lone.run() && lone.selected_index() == 1);  // Nothing parked, nothing counted
+    assert(c.metrics().select_wakeups == 0);
+
+    // Variadic select credits the channel the same way
+    thread late([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        a.send(3);
+    });
+    int got = 0;
+    size_t which = select(recv(a, [&](int v) { got = v; }), recv(b, [](int) {}));
+    late.join();
+    assert(which == 0 && got == 3);
+    assert(a.metrics().select_wakeups == 1);
+    assert(a.metrics().select_useful_wakeups == 1);
+    log("Testing metrics count select wake-ups and useful wake-ups completed...");
+}
+
+#if CHANNEL_HAS_COROUTINES
+
+Task<void> produce_awaiting(Channel<int>& ch, int count) {
+    for (int i = 0; i < count; ++i) co_await ch.async_send_awaitable(i);
+    ch.close();
+}
+
+Task<void> consume_awaiting(Channel<int>& ch, int& received) {
+    while (auto v = co_await ch.receive_awaitable()) received++;
+}
+
+void test_metrics_ignore_suspending_awaits() {
+    log("Testing metrics do not count a suspending co_await as a failed try_*...");
+    for (size_t cap : {0, 1}) {
+        Channel<int> ch(cap);
+        int received = 0;
+
+        CoroScheduler scheduler;
+        scheduler.spawn(consume_awaiting(ch, received));  // Runs first, so its first await suspends on an empty channel
+        scheduler.spawn(produce_awaiting(ch, 100));       // Fills the channel and suspends when it is full
+        scheduler.run();
+
+        ChannelMetrics m = ch.metrics();
+        assert(received == 100);
+        assert(m.sends == 100 && m.receives == 100);
+        assert(m.try_send_failures == 0);
+        assert(m.try_receive_failures == 0);
+    }
+    log("Testing metrics do not count a suspending co_await as a failed try_* completed...");
+}
+
+#endif  // CHANNEL_HAS_COROUTINES
+
+int main() {
+    test_metrics_count_buffered_traffic();
+    cout << "----------------------------------" << endl;
+    test_metrics_time_blocked_operations();
+    cout << "----------------------------------" << endl;
+    test_metrics_count_unbuffered_handoffs();
+    cout << "----------------------------------" << endl;
+    test_metrics_histogram_buckets();
+    cout << "----------------------------------" << endl;
+    test_metrics_select_wakeups();
+#if CHANNEL_HAS_COROUTINES
+    cout << "----------------------------------" << endl;
+    test_metrics_ignore_suspending_awaits();
+#endif
+
+    return 0;
+}
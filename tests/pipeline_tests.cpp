@@ -0,0 +1,389 @@
+// This is for testing the pipeline combinators
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/pipeline.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+// Sends 0..count-1 into `ch` on a new thread and closes it
+thread produce(Channel<int>& ch, int count) {
+    return thread([&ch, count]() {
+        for (int i = 0; i < count; ++i) ch.send(i);
+        ch.close();
+    });
+}
+
+// Receives everything left in `ch` until it is closed
+vector<int> drain(Channel<int>& ch) {
+    vector<int> out;
+    for (int v : ch) out.push_back(v);
+    return out;
+}
+
+void test_fused_map_filter_keeps_order() {
+    log("Testing fused map and filter stages...");
+    Channel<int> in(64), out(64);
+
+    auto run = Pipeline<int>::from(in)
+                   .map([](int v) { return v * 3; })
+                   .filter([](const int& v) { return v % 2 == 0; })
+                   .map([](int v) { return to_string(v); })
+                   .map([](string s) { return static_cast<int>(s.size()); })
+                   .filter([](const int& len) { return len > 0; })
+                   .to(out);
+
+    thread producer = produce(in, 1000);
+    vector<int> got = drain(out);  // Ends once the pipeline closes `out`
+    producer.join();
+    run.join();
+
+    // Every even multiple of 3 below 3000, as a digit count, in source order
+    assert(got.size() == 500);
+    size_t i = 0;
+    for (int v = 0; v < 1000; ++v) {
+        if ((v * 3) % 2 == 0) assert(got[i++] == static_cast<int>(to_string(v * 3).size()));
+    }
+    log("Testing fused map and filter stages completed...");
+}
+
+void test_merge_split_and_for_each() {
+    log("Testing merge, split and for_each...");
+    Channel<int> a(16), b(16), c(16);
+
+    auto merged = Pipeline<int>::merge(a, b, c);
+    assert(merged.lanes() == 3);
+    assert(merged.stage_capacity() == Pipeline<int>::default_stage_capacity);
+
+    // The list form bounds the hops later stages add, like from()
+    Channel<int> d(16), e(16);
+    auto bounded = Pipeline<int>::merge({&d, &e}, 8);
+    assert(bounded.lanes() == 2 && bounded.stage_capacity() == 8);
+    bool threw = false;
+    try {
+        Pipeline<int>::merge(vector<Channel<int>*>{});
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Items from one source keep their order; every item arrives once
+    mutex mtx;
+    vector<vector<int>> per_source(3);
+    auto run = merged.map([](int v) { return v; }).for_each([&](int v) {
+        lock_guard<mutex> lock(mtx);
+        per_source[v / 1000].push_back(v % 1000);
+    });
+
+    vector<thread> producers;
+    int source = 0;
+    for (Channel<int>* ch : {&a, &b, &c}) {
+        producers.emplace_back([ch, source]() {
+            for (int i = 0; i < 500; ++i) ch->send(source * 1000 + i);
+            ch->close();
+        });
+        ++source;
+    }
+    for (auto& t : producers) t.join();
+    run.join();
+    for (auto& items : per_source) {
+        assert(items.size() == 500);
+        for (int i = 0; i < 500; ++i) assert(items[i] == i);
+    }
+
+    // split() hands each item to exactly one branch
+    Channel<int> in(64), evens(64), odds(64);
+    auto branches = Pipeline<int>::from(in).split(2);
+    assert(branches.size() == 2);
+    auto left = branches[0].map([](int v) { return v * 2; }).to(evens);
+    auto right = branches[1].map([](int v) { return v * 2 + 1; }).to(odds);
+
+    thread producer = produce(in, 10000);
+    multiset<int> halves;
+    thread collect_odds([&]() {
+        for (int v : odds) {
+            lock_guard<mutex> lock(mtx);
+            halves.insert((v - 1) / 2);
+        }
+    });
+    for (int v : evens) {
+        lock_guard<mutex> lock(mtx);
+        halves.insert(v / 2);
+    }
+    collect_odds.join();
+    producer.join();
+    left.join();
+    right.join();
+    assert(halves.size() == 10000);
+    for (int i = 0; i < 10000; ++i) assert(halves.count(i) == 1);
+
+    threw = false;
+    try {
+        Pipeline<int>::from(in).split(0);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    log("Testing merge, split and for_each completed...");
+}
+
+void test_parallel_map_ordering() {
+    log("Testing parallel map with and without order...");
+    constexpr int total = 2000;
+    auto jitter = [](int v) {
+        if (v % 7 == 0) this_thread::sleep_for(chrono::microseconds(200));  // Make later items overtake
+        return v;
+    };
+
+    // Preserve: results leave in input order even though workers finish out of order
+    Channel<int> in(64), out(64);
+    auto ordered = Pipeline<int>::from(in).map(jitter, 4, StageOrder::Preserve).to(out);
+    thread producer = produce(in, total);
+    vector<int> got = drain(out);
+    producer.join();
+    ordered.join();
+    assert(got.size() == total);
+    for (int i = 0; i < total; ++i) assert(got[i] == i);
+
+    // Any: four workers, every item exactly once
+    Channel<int> in2(64), out2(64);
+    auto any = Pipeline<int>::from(in2).map(jitter, 4);
+    assert(any.lanes() == 4);
+    auto unordered = any.to(out2);
+    thread producer2 = produce(in2, total);
+    vector<int> got2 = drain(out2);
+    producer2.join();
+    unordered.join();
+    multiset<int> unique(got2.begin(), got2.end());
+    assert(unique.size() == total && *unique.begin() == 0 && *unique.rbegin() == total - 1);
+    for (int i = 0; i < total; ++i) assert(unique.count(i) == 1);
+    log("Testing parallel map with and without order completed...");
+}
+
+void test_batch_by_size_and_delay() {
+    log("Testing batch by size and by delay...");
+
+    // Full groups by size; the tail comes out as a partial group at close
+    Channel<int> in(64);
+    Channel<vector<int>> out(64);
+    auto run = Pipeline<int>::from(in).batch(10, chrono::seconds(5)).to(out);
+    thread producer = produce(in, 95);
+    vector<vector<int>> groups;
+    for (auto&& g : out) groups.push_back(std::move(g));
+    producer.join();
+    run.join();
+    assert(groups.size() == 10);
+    int next = 0;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        assert(groups[i].size() == (i < 9 ? 10u : 5u));
+        for (int v : groups[i]) assert(v == next++);
+    }
+
+    // A trickle is flushed by max_delay instead of waiting for a full group
+    Channel<int> slow(64);
+    Channel<vector<int>> flushed(64);
+    auto timed = Pipeline<int>::from(slow).filter([](const int&) { return true; }).batch(100, chrono::milliseconds(20)).to(flushed);
+    slow.send(1);
+    slow.send(2);
+    auto start = chrono::steady_clock::now();
+    auto group = flushed.receive();
+    assert(group.has_value() && group->size() == 2);
+    assert(chrono::steady_clock::now() - start < chrono::seconds(2));
+    slow.close();
+    assert(!flushed.receive().has_value());
+    timed.join();
+    log("Testing batch by size and by delay completed...");
+}
+
+void test_tee_copies_to_every_branch() {
+    log("Testing tee...");
+    Channel<int> in(16), doubled(16), negated(16);
+
+    auto branches = Pipeline<int>::from(in).tee(2);
+    assert(branches.size() == 2);
+    auto first = branches[0].map([](int v) { return v * 2; }).to(doubled);
+    auto second = branches[1].map([](int v) { return -v; }).to(negated);
+
+    thread producer = produce(in, 1000);
+    vector<int> got_negated;
+    thread reader([&]() { got_negated = drain(negated); });
+    vector<int> got_doubled = drain(doubled);
+    reader.join();
+    producer.join();
+    first.join();
+    second.join();
+
+    assert(got_doubled.size() == 1000 && got_negated.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(got_doubled[i] == i * 2);
+        assert(got_negated[i] == -i);
+    }
+    log("Testing tee completed...");
+}
+
+void test_stage_exception_reaches_join() {
+    log("Testing that a throwing stage surfaces through join()...");
+    Channel<int> in(16), out(16);
+    auto run = Pipeline<int>::from(in)
+                   .map([](int v) {
+                       if (v == 5) throw runtime_error("bad item");
+                       return v;
+                   })
+                   .to(out);
+
+    for (int i = 0; i < 10; ++i) in.send(i);
+    in.close();
+    vector<int> got = drain(out);  // The sink is still closed when the worker stops
+    assert((got == vector<int>{0, 1, 2, 3, 4}));
+
+    bool threw = false;
+    try {
+        run.join();
+    } catch (const runtime_error& e) {
+        threw = true;
+        log(string("Caught expected exception: ") + e.what());
+    }
+    assert(threw);
+
+    // An order-preserving map keeps going past a failed item without stalling the others
+    Channel<int> in2(16), out2(16);
+    auto ordered = Pipeline<int>::from(in2)
+                       .map([](int v) {
+                           if (v == 3) throw runtime_error("bad item");
+                           return v;
+                       },
+                            2, StageOrder::Preserve)
+                       .to(out2);
+    thread producer = produce(in2, 100);
+    vector<int> got2 = drain(out2);
+    producer.join();
+    threw = false;
+    try {
+        ordered.join();
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    for (size_t i = 1; i < got2.size(); ++i) assert(got2[i] > got2[i - 1]);
+    assert(find(got2.begin(), got2.end(), 3) == got2.end());
+    log("Testing that a throwing stage surfaces through join() completed...");
+}
+
+// Waits for `run` and reports whether join() rethrew the stage's exception
+bool join_throws(PipelineRun& run) {
+    try {
+        run.join();
+    } catch (const runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+void test_failed_stage_unblocks_upstream_hops() {
+    log("Testing that a failed stage behind a channel hop does not hang join()...");
+    auto failing = [](int v) {
+        if (v == 3) throw runtime_error("bad item");
+    };
+
+    // tee: one branch dies while the tee worker is blocked sending to it; the other still ends
+    {
+        Channel<int> in(256), out(256);
+        for (int i = 0; i < 200; ++i) in.send(i);
+        in.close();
+        auto branches = Pipeline<int>::from(in, 4).tee(2);
+        auto bad = branches[0].for_each(failing);
+        auto good = branches[1].to(out);
+        assert(join_throws(bad));
+        assert(join_throws(good));  // Both runs belong to the same pipeline
+        vector<int> got = drain(out);
+        for (size_t i = 0; i < got.size(); ++i) assert(got[i] == static_cast<int>(i));
+    }
+
+    // batch after other stages: the hop before it is closed once its only reader fails
+    {
+        Channel<int> in(256);
+        for (int i = 0; i < 200; ++i) in.send(i);
+        in.close();
+        auto run = Pipeline<int>::from(in, 4)
+                       .map([](int v) { return v + 1; })
+                       .batch(2, chrono::milliseconds(1))
+                       .for_each([](vector<int>&& group) {
+                           if (group.front() > 4) throw runtime_error("bad group");
+                       });
+        assert(join_throws(run));
+    }
+
+    // Order-preserving map: its workers blocked on the emit turn all unwind
+    {
+        Channel<int> in(256);
+        for (int i = 0; i < 200; ++i) in.send(i);
+        in.close();
+        auto run = Pipeline<int>::from(in, 4).map([](int v) { return v; }, 3, StageOrder::Preserve).for_each(failing);
+        assert(join_throws(run));
+    }
+    log("Testing that a failed stage behind a channel hop does not hang join() completed...");
+}
+
+int main() {
+    test_fused_map_filter_keeps_order();
+    cout << "----------------------------------" << endl;
+    test_merge_split_and_for_each();
+    cout << "----------------------------------" << endl;
+    test_parallel_map_ordering();
+    cout << "----------------------------------" << endl;
+    test_batch_by_size_and_delay();
+    cout << "----------------------------------" << endl;
+    test_tee_copies_to_every_branch();
+    cout << "----------------------------------" << endl;
+    test_stage_exception_reaches_join();
+    cout << "----------------------------------" << endl;
+    test_failed_stage_unblocks_upstream_hops();
+
+    return 0;
+}
@@ -1,16 +1,19 @@
 // This is for testing the selectors
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
 #include <string>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "../include/channel.hpp"
 #include "../include/select.hpp"
@@ -121,6 +124,88 @@ void test_select_multiple_ready_randomness() {
     log("Testing select multiple ready randomness completed...");
 }
 
+void test_select_random_policy_spreads() {
+    log("Testing random policy picks every ready case...");
+    Channel<int> ch1(1), ch2(1), ch3(1);
+    int counts[3] = {0, 0, 0};
+
+    for (int i = 0; i < 3000; ++i) {
+        Select<int> round;  // SelectPolicy::Random by default
+        round.send(ch1, i).send(ch2, i).send(ch3, i);
+        assert(round.run());
+        size_t idx = round.selected_index();
+        counts[idx]++;
+        Channel<int>* chans[3] = {&ch1, &ch2, &ch3};
+        assert(chans[idx]->try_receive() == i);
+    }
+    for (int c : counts) assert(c > 700);  // Expected ~1000 each
+
+    log("Testing random policy picks every ready case completed...");
+}
+
+void test_select_priority_policy() {
+    log("Testing priority policy prefers earlier cases...");
+    Channel<int> control(8), data(8);
+    for (int i = 0; i < 4; ++i) {
+        data.send(100 + i);
+        control.send(i);
+    }
+
+    Select<int> sel(SelectPolicy::Priority);
+    sel.receive(control).receive(data);
+
+    // Every control message wins over the waiting data, then data drains in order
+    for (int i = 0; i < 4; ++i) {
+        assert(sel.run());
+        assert(sel.selected_index() == 0);
+        assert(sel.received_value() == i);
+    }
+    for (int i = 0; i < 4; ++i) {
+        assert(sel.run());
+        assert(sel.selected_index() == 1);
+        assert(sel.received_value() == 100 + i);
+    }
+    assert(!sel.run());
+
+    // run_blocking honours the priority too
+    data.send(7);
+    control.send(8);
+    auto idx = sel.run_blocking(chrono::milliseconds(100));
+    assert(idx == 0u);
+    assert(sel.received_value() == 8);
+
+    log("Testing priority policy prefers earlier cases completed...");
+}
+
+void test_select_round_robin_policy() {
+    log("Testing round-robin policy rotates through ready cases...");
+    Channel<int> ch1(16), ch2(16), ch3(16);
+    for (int i = 0; i < 6; ++i) {
+        ch1.send(i);
+        ch2.send(i);
+        ch3.send(i);
+    }
+
+    Select<int> sel;
+    sel.policy(SelectPolicy::RoundRobin).receive(ch1).receive(ch2).receive(ch3);
+    for (size_t i = 0; i < 12; ++i) {
+        assert(sel.run());
+        assert(sel.selected_index() == i % 3);
+    }
+
+    // A case that is not ready is skipped without breaking the rotation
+    while (ch2.try_receive()) {
+    }
+    vector<size_t> order;
+    for (int i = 0; i < 4; ++i) {
+        assert(sel.run());
+        order.push_back(sel.selected_index());
+    }
+    assert((order == vector<size_t>{0, 2, 0, 2}));
+
+    log("Testing round-robin policy rotates through ready cases completed...");
+}
+
 void test_select_with_async_send() {
     log("Testing select with asynchronous send...");
     Channel<int> ch1(1), ch2(1);
@@ -308,6 +393,309 @@ void test_fan_in_with_select_blocking_cv() {
     log("Testing fan-in with select (blocking cv) completed...");
 }
 
+void test_select_move_only_payloads() {
+    log("Testing select with move-only payloads...");
+    Channel<unique_ptr<int>> ch1(1), ch2(1);
+    ch1.send(make_unique<int>(11));
+
+    Select<unique_ptr<int>> sel;
+    sel.receive(ch1).receive(ch2);
+    assert(sel.run());
+    assert(sel.selected_index() == 0);
+    auto val = sel.take_received_value();
+    assert(val.has_value() && **val == 11);
+    assert(!sel.take_received_value().has_value());  // Already moved out
+
+    Select<unique_ptr<int>> send_sel;
+    send_sel.send(ch2, make_unique<int>(22));
+    assert(send_sel.run());
+    auto sent = ch2.try_receive();
+    assert(sent.has_value() && **sent == 22);
+
+    log("Testing select with move-only payloads completed...");
+}
+
+struct Request {
+    int id;
+};
+struct Shutdown {};
+
+void test_heterogeneous_select_non_blocking() {
+    log("Testing select over channels of different types...");
+    Channel<Request> requests(1);
+    Channel<string> names(1);
+    Channel<int> replies(1);
+
+    int got_request = -1;
+    bool defaulted = false;
+
+    // Nothing ready: the default case runs
+    size_t index = select(recv(requests, [&](Request&& r) { got_request = r.id; }),
+                          recv(names, [](string&&) { assert(false); }),
+                          default_([&]() { defaulted = true; }));
+    assert(index == 2 && defaulted);
+
+    requests.send(Request{7});
+    index = select(recv(requests, [&](Request&& r) { got_request = r.id; }),
+                   recv(names, [](string&&) { assert(false); }),
+                   default_());
+    assert(index == 0 && got_request == 7);
+
+    // A send case moves its value only when it runs
+    bool sent = false;
+    index = select(send(replies, 42, [&]() { sent = true; }), default_());
+    assert(index == 0 && sent);
+    index = select(send(replies, 43), default_());  // Buffer is full now
+    assert(index == 1);
+    assert(replies.receive().value() == 42);
+
+    log("Testing select over channels of different types completed...");
+}
+
+void test_heterogeneous_select_blocking() {
+    log("Testing blocking select woken by another thread...");
+    Channel<Request> requests;  // Unbuffered: ready only once a sender parks
+    Channel<Shutdown> shutdown(1);
+
+    thread client([&]() {
+        for (int i = 0; i < 100; ++i) requests.send(Request{i});
+        shutdown.send(Shutdown{});
+    });
+
+    int handled = 0;
+    bool running = true;
+    while (running) {
+        select(recv(requests, [&](Request&& r) { assert(r.id == handled++); }),
+               recv(shutdown, [&](Shutdown&&) { running = false; }));
+    }
+    client.join();
+    assert(handled == 100);
+
+    log("Testing blocking select woken by another thread completed...");
+}
+
+void test_heterogeneous_select_observes_close() {
+    log("Testing select receive case observing close...");
+    Channel<int> work(2);
+    work.send(1);
+    work.close();
+
+    vector<optional<int>> seen;
+    auto handler = [&](optional<int> v) { seen.push_back(v); };
+    select(recv(work, handler));  // Buffered value first
+    select(recv(work, handler));  // Then closed and drained
+    assert(seen.size() == 2 && seen[0] == 1 && !seen[1].has_value());
+
+    // A blocked select wakes up when the channel closes
+    Channel<int> idle;
+    thread late_close([&]() {
+        this_thread::sleep_for(chrono::milliseconds(30));
+        idle.close();
+    });
+    bool closed = false;
+    select(recv(idle, [&](optional<int> v) { closed = !v.has_value(); }));
+    late_close.join();
+    assert(closed);
+
+    log("Testing select receive case observing close completed...");
+}
+
+void test_heterogeneous_select_stress() {
+    log("Testing heterogeneous select with several producers...");
+    constexpr int per_producer = 3000;
+    Channel<int> ints(8);
+    Channel<string> strings;
+    Channel<Request> requests(1);
+
+    thread p1([&]() { for (int i = 0; i < per_producer; ++i) ints.send(i); });
+    thread p2([&]() { for (int i = 0; i < per_producer; ++i) strings.send(to_string(i)); });
+    thread p3([&]() { for (int i = 0; i < per_producer; ++i) requests.send(Request{i}); });
+
+    int next_int = 0, next_string = 0, next_request = 0;
+    for (int received = 0; received < 3 * per_producer; ++received) {
+        select(recv(ints, [&](int&& v) { assert(v == next_int++); }),
+               recv(strings, [&](string&& v) { assert(v == to_string(next_string++)); }),
+               recv(requests, [&](Request&& r) { assert(r.id == next_request++); }));
+    }
+    p1.join();
+    p2.join();
+    p3.join();
+    assert(next_int == per_producer && next_string == per_producer && next_request == per_producer);
+
+    log("Testing heterogeneous select with several producers completed...");
+}
+
+void test_run_blocking_leaves_no_registrations() {
+    log("Testing run_blocking leaves nothing registered on the channels...");
+    Channel<int> ch(1);
+
+    // Each short-lived select times out; none of them may be touched by later sends
+    for (int i = 0; i < 1000; ++i) {
+        Select<int> sel;
+        sel.receive(ch);
+        assert(!sel.run_blocking(chrono::milliseconds(0)).has_value());
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ch.send(i);
+        assert(ch.receive().value() == i);
+    }
+
+    log("Testing run_blocking leaves nothing registered on the channels completed...");
+}
+
+void test_run_blocking_reports_fired_case() {
+    log("Testing run_blocking wakes on the case whose channel became ready...");
+    Channel<int> quiet(1), busy(1);
+    Select<int> sel;
+    sel.receive(quiet).receive(busy);
+
+    thread sender([&]() {
+        for (int i = 0; i < 200; ++i) busy.send(i);
+    });
+    for (int i = 0; i < 200; ++i) {
+        auto index = sel.run_blocking(chrono::seconds(5));
+        assert(index && *index == 1);
+        assert(sel.take_received_value().value() == i);
+    }
+    sender.join();
+
+    log("Testing run_blocking wakes on the case whose channel became ready completed...");
+}
+
+void test_run_blocking_send_waits_for_receiver() {
+    log("Testing run_blocking send case waits for an unbuffered receiver...");
+    Channel<int> ch;
+    Select<int> sel;
+    sel.send(ch, 5);
+
+    thread receiver([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        assert(ch.receive().value() == 5);
+    });
+    auto index = sel.run_blocking(chrono::seconds(5));
+    assert(index && *index == 0);
+    receiver.join();
+
+    log("Testing run_blocking send case waits for an unbuffered receiver completed...");
+}
+
+void test_run_blocking_cancel_wakes_waiter() {
+    log("Testing cancel wakes a blocked run_blocking...");
+    Channel<int> ch;
+    Select<int> sel;
+    sel.receive(ch);
+
+    thread canceller([&]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        sel.cancel();
+    });
+    auto start = chrono::steady_clock::now();
+    assert(!sel.run_blocking().has_value());  // No timeout: only cancel() can end the wait
+    assert(chrono::steady_clock::now() - start < chrono::seconds(5));
+    canceller.join();
+
+    log("Testing cancel wakes a blocked run_blocking completed...");
+}
+
+void test_select_commits_one_send_case() {
+    log("Testing select commits exactly one of several ready send cases...");
+    constexpr int chans = 4, rounds = 2000;
+    vector<unique_ptr<Channel<int>>> outs;
+    for (int i = 0; i < chans; ++i) outs.push_back(make_unique<Channel<int>>(rounds));
+
+    // Every send case is ready on every run(); exactly one of them may take effect
+    for (int r = 0; r < rounds; ++r) {
+        Select<int> sel;
+        for (auto& ch : outs) sel.send(*ch, r);
+        assert(sel.run());
+        size_t fired = 0;
+        for (int i = 0; i < chans; ++i) fired += sel.case_succeeded(i) ? 1 : 0;
+        assert(fired == 1);
+    }
+
+    size_t total = 0;
+    set<int> values;
+    for (auto& ch : outs) {
+        while (auto v = ch->try_receive()) {
+            total++;
+            values.insert(*v);
+        }
+    }
+    assert(total == rounds);
+    assert(values.size() == rounds);  // No round was delivered twice
+
+    log("Testing select commits exactly one of several ready send cases completed...");
+}
+
+void test_select_one_effect_under_contention() {
+    log("Testing select has one effect per run while racing other threads...");
+    constexpr int selectors = 3, per_selector = 3000;
+    Channel<int> a(2), b(2);
+    atomic<int> committed{0};
+
+    // Competing plain receivers make the selectors lose races between probe and commit
+    mutex mtx;
+    vector<int> received;
+    auto drain = [&](Channel<int>& ch) {
+        while (auto v = ch.receive()) {
+            lock_guard lock(mtx);
+            received.push_back(*v);
+        }
+    };
+    thread ra([&]() { drain(a); });
+    thread rb([&]() { drain(b); });
+
+    vector<thread> threads;
+    for (int s = 0; s < selectors; ++s) {
+        threads.emplace_back([&, s]() {
+            for (int i = 0; i < per_selector; ++i) {
+                Select<int> sel;
+                int value = s * per_selector + i;
+                sel.send(a, value).send(b, value);
+                auto index = sel.run_blocking(chrono::seconds(5));
+                assert(index.has_value());
+                committed++;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    a.close();
+    b.close();
+    ra.join();
+    rb.join();
+
+    assert(committed == selectors * per_selector);
+    assert(received.size() == static_cast<size_t>(selectors * per_selector));
+    set<int> unique(received.begin(), received.end());
+    assert(unique.size() == received.size());
+
+    log("Testing select has one effect per run while racing other threads completed...");
+}
+
+void test_select_send_case_repeats() {
+    log("Testing an lvalue send case fires on every run...");
+    Channel<int> ch(8);
+    int value = 7;
+    Select<int> sel;
+    sel.send(ch, value);
+
+    for (int i = 0; i < 5; ++i) assert(sel.run());  // The registered value is copied each time
+    assert(ch.len() == 5);
+    while (auto v = ch.try_receive()) assert(*v == 7);
+
+    // A blocking run still finds the case after earlier runs used it
+    assert(sel.run_blocking(chrono::milliseconds(200)) == optional<size_t>(0));
+    assert(ch.try_receive() == 7);
+
+    // An rvalue registration is moved into the channel and fires once
+    Select<int> once;
+    once.send(ch, 9);
+    assert(once.run());
+    assert(!once.run());
+    assert(ch.try_receive() == 9);
+    log("Testing an lvalue send case fires on every run completed...");
+}
+
 int main() {
     test_select_recv_ready();
     cout << "----------------------------------" << endl;
@@ -317,6 +705,12 @@ int main() {
     cout << "----------------------------------" << endl;
     test_select_multiple_ready_randomness();
     cout << "----------------------------------" << endl;
+    test_select_random_policy_spreads();
+    cout << "----------------------------------" << endl;
+    test_select_priority_policy();
+    cout << "----------------------------------" << endl;
+    test_select_round_robin_policy();
+    cout << "----------------------------------" << endl;
     test_select_with_async_send();
     cout << "----------------------------------" << endl;
     test_select_async_receive_with_default();
@@ -326,6 +720,30 @@ int main() {
     test_select_multiple_async_receives();
     cout << "----------------------------------" << endl;
     test_fan_in_with_select_blocking_cv();
+    cout << "----------------------------------" << endl;
+    test_select_move_only_payloads();
+    cout << "----------------------------------" << endl;
+    test_heterogeneous_select_non_blocking();
+    cout << "----------------------------------" << endl;
+    test_heterogeneous_select_blocking();
+    cout << "----------------------------------" << endl;
+    test_heterogeneous_select_observes_close();
+    cout << "----------------------------------" << endl;
+    test_heterogeneous_select_stress();
+    cout << "----------------------------------" << endl;
+    test_run_blocking_leaves_no_registrations();
+    cout << "----------------------------------" << endl;
+    test_run_blocking_reports_fired_case();
+    cout << "----------------------------------" << endl;
+    test_run_blocking_send_waits_for_receiver();
+    cout << "----------------------------------" << endl;
+    test_run_blocking_cancel_wakes_waiter();
+    cout << "----------------------------------" << endl;
+    test_select_commits_one_send_case();
+    cout << "----------------------------------" << endl;
+    test_select_one_effect_under_contention();
+    cout << "----------------------------------" << endl;
+    test_select_send_case_repeats();
 
     return 0;
 }
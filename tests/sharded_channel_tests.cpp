@@ -0,0 +1,279 @@
+// This is for testing the sharded work-stealing channel
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/sharded_channel.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+// Runs `fn` on a new thread whose home shard is `shard`; threads get shards round-robin, so this takes at most a lap
+template <typename F>
+thread on_shard(ShardedChannel<int>& ch, size_t shard, F fn) {
+    while (true) {
+        atomic<int> decided{0};  // 1: this thread runs fn, 2: wrong shard
+        thread t([&ch, shard, fn, &decided]() mutable {
+            bool match = ch.home_shard() == shard;
+            decided = match ? 1 : 2;
+            if (match) fn();
+        });
+        while (decided == 0) this_thread::yield();
+        if (decided == 1) return t;
+        t.join();
+    }
+}
+
+void test_sharded_send_receive() {
+    log("Testing sharded send and receive...");
+    ShardedChannel<int> ch(4, 3);
+    assert(ch.shard_count() == 3 && ch.cap() == 12);
+    assert(ch.empty() && ch.len() == 0);
+
+    ch.send(1);
+    ch.send(2);
+    assert(ch.len() == 2 && !ch.empty());
+
+    // One thread's items stay in order
+    assert(ch.receive().value() == 1);
+    assert(ch.receive().value() == 2);
+    assert(!ch.try_receive().has_value());
+
+    ShardedChannel<int> automatic(4);
+    assert(automatic.shard_count() == max(1u, thread::hardware_concurrency()));
+
+    bool threw = false;
+    try {
+        ShardedChannel<int> invalid(0);
+    } catch (const invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    log("Testing sharded send and receive completed...");
+}
+
+void test_sharded_receivers_steal() {
+    log("Testing sharded receivers steal from other shards...");
+    ShardedChannel<int> ch(8, 2);
+    size_t other = (ch.home_shard() + 1) % 2;
+
+    on_shard(ch, other, [&ch]() {
+        for (int i = 0; i < 5; ++i) ch.send(i);
+    }).join();
+
+    // Our own shard is empty, so every item comes from the other one, still in its send order
+    for (int i = 0; i < 5; ++i) assert(ch.try_receive().value() == i);
+    assert(ch.empty());
+    log("Testing sharded receivers steal completed...");
+}
+
+void test_sharded_full_shard_blocks_only_its_senders() {
+    log("Testing a full home shard only blocks its own senders...");
+    ShardedChannel<int> ch(2, 2);
+    size_t home = ch.home_shard();
+    size_t other = (home + 1) % 2;
+
+    assert(ch.try_send(1));
+    assert(ch.try_send(2));
+    assert(!ch.try_send(3));  // Home shard full, even though the other one is empty
+
+    // A sender living on the other shard still has room
+    on_shard(ch, other, [&ch]() { assert(ch.try_send(10)); }).join();
+    assert(ch.len() == 3);
+
+    // A sender sharing the full shard blocks until a receive drains it
+    atomic<bool> sent{false};
+    thread blocked = on_shard(ch, home, [&]() {
+        ch.send(3);
+        sent = true;
+    });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    assert(!sent);
+
+    assert(ch.receive().value() == 1);  // Home shard first
+    blocked.join();
+    assert(sent);
+
+    multiset<int> rest;
+    while (auto v = ch.try_receive()) rest.insert(*v);
+    assert((rest == multiset<int>{2, 3, 10}));
+    log("Testing a full home shard only blocks its own senders completed...");
+}
+
+void test_sharded_close_semantics() {
+    log("Testing sharded close semantics...");
+    ShardedChannel<int> ch(4, 2);
+    ch.send(7);
+    on_shard(ch, (ch.home_shard() + 1) % 2, [&ch]() { ch.send(8); }).join();
+    ch.close();
+
+    assert(ch.is_closed());
+    assert(!ch.try_send(9));
+    try {
+        ch.send(9);
+        assert(false && "Expected exception from send after close");
+    } catch (const runtime_error& e) {
+        log(string("Caught expected exception: ") + e.what());
+    }
+
+    // Every shard drains before receivers see the close
+    multiset<int> got;
+    while (auto v = ch.receive()) got.insert(*v);
+    assert((got == multiset<int>{7, 8}));
+
+    // close() releases a parked sender...
+    ShardedChannel<int> full(1, 2);
+    full.send(1);
+    atomic<bool> threw{false};
+    thread sender = on_shard(full, full.home_shard(), [&]() {
+        try {
+            full.send(2);  // Home shard full: parks until close
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+    });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    full.close();
+    sender.join();
+    assert(threw);
+
+    // ...and a parked receiver
+    ShardedChannel<int> idle(1, 2);
+    thread receiver([&idle]() { assert(!idle.receive().has_value()); });
+    this_thread::sleep_for(chrono::milliseconds(20));
+    idle.close();
+    receiver.join();
+    log("Testing sharded close semantics completed...");
+}
+
+void test_sharded_many_producers_and_consumers() {
+    log("Testing sharded channel with many producers and consumers...");
+    constexpr int producers = 4, consumers = 4, per_producer = 50000;
+    ShardedChannel<int> ch(64, 4);
+
+    vector<vector<int>> received(consumers);
+    vector<thread> threads;
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            vector<int> last(producers, -1);
+            while (auto v = ch.receive()) {
+                int producer = *v / per_producer, seq = *v % per_producer;
+                assert(seq > last[producer]);  // Per-producer order survives stealing
+                last[producer] = seq;
+                received[c].push_back(*v);
+            }
+        });
+    }
+    vector<thread> senders;
+    for (int p = 0; p < producers; ++p) {
+        senders.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; ++i) ch.send(p * per_producer + i);
+        });
+    }
+    for (auto& t : senders) t.join();
+    ch.close();
+    for (auto& t : threads) t.join();
+
+    vector<int> counts(producers * per_producer, 0);
+    for (auto& r : received) {
+        for (int v : r) counts[v]++;
+    }
+    for (int c : counts) assert(c == 1);  // Nothing lost or duplicated
+    log("Testing sharded channel with many producers and consumers completed...");
+}
+
+void test_sharded_close_never_strands_accepted_sends() {
+    log("Testing every sharded send accepted before close is received...");
+    for (int round = 0; round < 50; round++) {
+        ShardedChannel<int> ch(4, 2, WaitStrategy::spin_then_park());
+        atomic<int> sent{0};
+        atomic<int> received{0};
+
+        vector<thread> senders;
+        for (int s = 0; s < 3; s++) {
+            senders.emplace_back([&]() {
+                try {
+                    for (int i = 0;; i++) {
+                        if (i % 2 == 0) {
+                            ch.send(i);
+                        } else if (!ch.try_send(i)) {
+                            continue;
+                        }
+                        sent++;
+                    }
+                } catch (const runtime_error&) {
+                }
+            });
+        }
+        vector<thread> receivers;
+        for (int r = 0; r < 2; r++) {
+            receivers.emplace_back([&]() {
+                while (ch.receive()) received++;
+            });
+        }
+
+        this_thread::sleep_for(chrono::microseconds(200));
+        ch.close();
+        for (auto& t : senders) t.join();
+        for (auto& t : receivers) t.join();
+        assert(received == sent);
+        assert(!ch.try_receive());
+    }
+    log("Testing every sharded send accepted before close is received completed...");
+}
+
+int main() {
+    test_sharded_send_receive();
+    cout << "----------------------------------" << endl;
+    test_sharded_receivers_steal();
+    cout << "----------------------------------" << endl;
+    test_sharded_full_shard_blocks_only_its_senders();
+    cout << "----------------------------------" << endl;
+    test_sharded_close_semantics();
+    cout << "----------------------------------" << endl;
+    test_sharded_many_producers_and_consumers();
+    cout << "----------------------------------" << endl;
+    test_sharded_close_never_strands_accepted_sends();
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+// This is for testing the single-producer/single-consumer channel
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../include/spsc_channel.hpp"
+
+using namespace std;
+
+void log(const std::string& message) {
+    // Get current time
+    auto now = std::chrono::system_clock::now();
+
+    // Extract time_t and milliseconds
+    auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       now.time_since_epoch()) %
+                   1000;
+
+    // Format to tm
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time_t_now);
+#else
+    localtime_r(&time_t_now, &tm);
+#endif
+
+    // Get hashed thread ID
+    size_t thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    // Compose output
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H:%M:%S")
+        << '.' << std::setw(3) << std::setfill('0') << ms_part.count()
+        << " [Thread " << thread_id << "] "
+        << message;
+
+    std::cout << oss.str() << std::endl;
+}
+
+void test_spsc_send_receive() {
+    log("Testing spsc send and receive...");
+    SpscChannel<int> ch(2);
+
+    ch.send(1);
+    ch.send(2);
+    assert(!ch.empty());
+
+    assert(ch.receive().value() == 1);
+    assert(ch.receive().value() == 2);
+    assert(ch.empty());
+
+    log("Testing spsc send and receive completed...");
+}
+
+void test_spsc_exact_capacity() {
+    log("Testing spsc capacity is exact for non power of two sizes...");
+    SpscChannel<int> ch(3);
+
+    assert(ch.try_send(1));
+    assert(ch.try_send(2));
+    assert(ch.try_send(3));
+    assert(!ch.try_send(4));  // Full even though 4 slots are allocated
+
+    assert(ch.try_receive().value() == 1);
+    assert(ch.try_send(4));
+    assert(ch.try_receive().value() == 2);
+    assert(ch.try_receive().value() == 3);
+    assert(ch.try_receive().value() == 4);
+    assert(!ch.try_receive().has_value());
+
+    log("Testing spsc capacity is exact completed...");
+}
+
+void test_spsc_close_semantics() {
+    log("Testing spsc close semantics...");
+    SpscChannel<int> ch(4);
+    ch.send(7);
+    ch.close();
+
+    assert(ch.is_closed());
+    assert(!ch.try_send(8));
+    try {
+        ch.send(8);
+        assert(false && "Expected exception from send after close");
+    } catch (const runtime_error& e) {
+        log(string("Caught expected exception: ") + e.what());
+    }
+
+    assert(ch.receive().value() == 7);     // Buffered items survive close
+    assert(!ch.receive().has_value());     // Then closed and drained
+    log("Testing spsc close semantics completed...");
+}
+
+void test_spsc_close_wakes_receiver() {
+    log("Testing spsc close wakes a blocked receiver...");
+    SpscChannel<int> ch(1);
+
+    thread receiver([&ch]() {
+        auto v = ch.receive();
+        assert(!v.has_value());
+    });
+
+    this_thread::sleep_for(chrono::milliseconds(100));
+    ch.close();
+    receiver.join();
+    log("Testing spsc close wakes a blocked receiver completed...");
+}
+
+void test_spsc_move_only_payload() {
+    log("Testing spsc with move-only payload...");
+    SpscChannel<unique_ptr<int>> ch(1);
+
+    auto p = make_unique<int>(5);
+    assert(ch.try_send(std::move(p)));
+    assert(p == nullptr);
+
+    auto q = make_unique<int>(6);
+    assert(!ch.try_send(std::move(q)));
+    assert(q != nullptr && *q == 6);  // Left untouched on failure
+
+    auto got = ch.receive();
+    assert(got.has_value() && **got == 5);
+    log("Testing spsc with move-only payload completed...");
+}
+
+void test_spsc_streaming_order() {
+    log("Testing spsc streaming preserves order...");
+    constexpr int total = 1000000;
+    SpscChannel<int> ch(64);
+
+    auto start = chrono::steady_clock::now();
+    thread producer([&ch]() {
+        for (int i = 0; i < total; ++i) ch.send(i);
+        ch.close();
+    });
+
+    int expected = 0;
+    while (auto v = ch.receive()) {
+        assert(*v == expected);
+        ++expected;
+    }
+    producer.join();
+    assert(expected == total);
+
+    auto secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    ostringstream oss;
+    oss << "Streamed " << total << " items in order (" << fixed << setprecision(1) << (total / secs / 1e6)
+        << " M msg/s)";
+    log(oss.str());
+    log("Testing spsc streaming preserves order completed...");
+}
+
+void test_spsc_len_and_cap() {
+    log("Testing spsc len and cap...");
+    SpscChannel<int> ch(3);
+    assert(ch.cap() == 3 && ch.len() == 0);
+    ch.send(1);
+    ch.send(2);
+    assert(ch.len() == 2);
+    ch.receive();
+    assert(ch.len() == 1);
+    log("Testing spsc len and cap completed...");
+}
+
+void test_spsc_close_never_strands_accepted_sends() {
+    log("Testing every spsc send accepted before close is received...");
+    for (int round = 0; round < 50; round++) {
+        SpscChannel<int> ch(4);
+        atomic<int> sent{0};
+        atomic<int> received{0};
+
+        thread sender([&]() {
+            try {
+                for (int i = 0;; i++) {
+                    if (i % 2 == 0) {
+                        ch.send(i);
+                    } else if (!ch.try_send(i)) {
+                        continue;
+                    }
+                    sent++;
+                }
+            } catch (const runtime_error&) {
+            }
+        });
+        thread receiver([&]() {
+            while (ch.receive()) received++;
+        });
+
+        this_thread::sleep_for(chrono::microseconds(200));
+        ch.close();
+        sender.join();
+        receiver.join();
+        assert(received == sent);
+        assert(!ch.try_receive());
+    }
+    log("Testing every spsc send accepted before close is received completed...");
+}
+
+int main() {
+    test_spsc_send_receive();
+    cout << "----------------------------------" << endl;
+    test_spsc_exact_capacity();
+    cout << "----------------------------------" << endl;
+    test_spsc_close_semantics();
+    cout << "----------------------------------" << endl;
+    test_spsc_close_wakes_receiver();
+    cout << "----------------------------------" << endl;
+    test_spsc_move_only_payload();
+    cout << "----------------------------------" << endl;
+    test_spsc_streaming_order();
+    cout << "----------------------------------" << endl;
+    test_spsc_len_and_cap();
+    cout << "----------------------------------" << endl;
+    test_spsc_close_never_strands_accepted_sends();
+
+    return 0;
+}